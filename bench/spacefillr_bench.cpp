@@ -0,0 +1,387 @@
+// Standalone throughput/latency/memory benchmark for the spacefillr generators.
+// It only uses the headers in inst/include, so it builds without R. From the
+// package root:
+//
+//   g++ -std=c++17 -O2 -pthread -Iinst/include bench/spacefillr_bench.cpp -o spacefillr_bench
+//   ./spacefillr_bench [--quick] [--reps N] [--filter SUBSTRING] [--out FILE]
+//
+// Results are written as JSON (to stdout unless --out is given), one record
+// per (generator, n, dims) case:
+//   samples_per_call   values produced by one call (points * dims)
+//   median_ns_per_call median wall time of one call over the repetitions
+//   min_ns_per_call    fastest call
+//   ns_per_sample      median_ns_per_call / samples_per_call
+//   ns_per_point       median_ns_per_call / n, the latency of one point with
+//                      all its dims
+//   samples_per_sec    samples_per_call / median time
+//   peak_heap_bytes    largest heap growth during a call, from the counting
+//                      operator new below
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "sobol.h"
+#include "sobol_simd.h"
+#include "sobol_lut.h"
+#include "halton_sampler.h"
+#include "halton_batch.h"
+#include "halton_engine.h"
+#include "low_discrepancy.h"
+#include "pj.h"
+#include "pmj.h"
+#include "pmj02.h"
+#include "samplerBlueNoise.h"
+#include "rng.h"
+
+//----------------------------------------------------------------------
+// Heap accounting
+//
+// Every allocation is prefixed with its size so the live byte count can be
+// tracked; the peak is reset before each timed call.
+
+static std::atomic<long long> heap_live(0);
+static std::atomic<long long> heap_peak(0);
+
+static const size_t HeapHeader = 16;
+
+static void* counted_alloc(size_t size) {
+  void* p = std::malloc(size + HeapHeader);
+  if(!p) {
+    throw std::bad_alloc();
+  }
+  *(size_t*)p = size;
+  const long long live = heap_live += (long long)size;
+  long long peak = heap_peak.load();
+  while(live > peak && !heap_peak.compare_exchange_weak(peak, live)) {}
+  return((char*)p + HeapHeader);
+}
+
+static void counted_free(void* p) {
+  if(!p) {
+    return;
+  }
+  void* base = (char*)p - HeapHeader;
+  heap_live -= (long long)*(size_t*)base;
+  std::free(base);
+}
+
+void* operator new(size_t size) { return(counted_alloc(size)); }
+void* operator new[](size_t size) { return(counted_alloc(size)); }
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, size_t) noexcept { counted_free(p); }
+
+//----------------------------------------------------------------------
+// Cases
+
+// Keeps the optimizer from discarding generated values.
+static volatile double bench_sink = 0;
+
+struct bench_case {
+  std::string name;
+  uint64_t n;
+  uint32_t dims;
+  // Runs one call and returns a checksum of its output.
+  std::function<double()> run;
+};
+
+struct bench_result {
+  bench_case c;
+  int reps;
+  double median_ns;
+  double min_ns;
+  long long peak_heap;
+};
+
+static double sum_points(const std::unique_ptr<pmj::Point[]>& points, uint64_t n) {
+  double sum = 0;
+  for(uint64_t i = 0; i < n; i++) {
+    sum += points[i].x + points[i].y;
+  }
+  return(sum);
+}
+
+static std::vector<bench_case> make_cases(bool quick) {
+  std::vector<bench_case> cases;
+  const std::vector<uint64_t> single_sizes = quick ? std::vector<uint64_t>{4096} :
+                                                     std::vector<uint64_t>{4096, 65536};
+  const std::vector<uint32_t> single_dims = quick ? std::vector<uint32_t>{1, 16} :
+                                                    std::vector<uint32_t>{1, 16, 256};
+  const std::vector<uint64_t> set_sizes = quick ? std::vector<uint64_t>{1024, 4096} :
+                                                  std::vector<uint64_t>{1024, 16384, 65536};
+  const std::vector<uint64_t> bn_sizes = quick ? std::vector<uint64_t>{1024} :
+                                                 std::vector<uint64_t>{1024, 4096, 16384};
+  const uint32_t seed = 12345;
+
+  for(uint64_t n : single_sizes) {
+    for(uint32_t dims : single_dims) {
+      cases.push_back({"sobol_single", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += spacefillr::sobol_single(i, d, seed);
+          }
+        }
+        return(sum);
+      }});
+      cases.push_back({"sobol_owen_single", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += spacefillr::sobol_owen_single(i, d, seed);
+          }
+        }
+        return(sum);
+      }});
+      cases.push_back({"sobol_batch_generator", n, dims, [=]() {
+        std::vector<double> out(n * dims);
+        spacefillr::sobol_batch_generator gen(dims, seed);
+        gen.generate(n, out.data(), n);
+        return(out[n * dims - 1]);
+      }});
+      cases.push_back({"sobol_owen_block", n, dims, [=]() {
+        std::vector<double> out(n * dims);
+        spacefillr::sobol_owen_block(0, n, dims, seed, out.data(), n);
+        return(out[n * dims - 1]);
+      }});
+      auto lut = std::make_shared<spacefillr::sobol_lut_engine>(spacefillr::sobol_directions::owen);
+      lut->prepare(0, dims);
+      cases.push_back({"sobol_lut_owen", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += lut->sobol_owen_single(i, d, seed);
+          }
+        }
+        return(sum);
+      }});
+      auto faure = std::make_shared<spacefillr::Halton_sampler>();
+      faure->init_faure();
+      cases.push_back({"halton_faure", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += faure->sample(d, i);
+          }
+        }
+        return(sum);
+      }});
+      auto random = std::make_shared<spacefillr::Halton_sampler>();
+      random_gen rng(seed);
+      random->init_random(rng.rng);
+      cases.push_back({"halton_random", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += random->sample(d, i);
+          }
+        }
+        return(sum);
+      }});
+      cases.push_back({"halton_random_f64", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += random->sample_f64(d, i);
+          }
+        }
+        return(sum);
+      }});
+      cases.push_back({"halton_sample_point", n, dims, [=]() {
+        std::vector<float> point(dims);
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          random->sample_point(i, point.data(), dims);
+          sum += point[i % dims];
+        }
+        return(sum);
+      }});
+      auto engine = std::make_shared<spacefillr::halton_engine>(dims);
+      engine->init_faure();
+      cases.push_back({"halton_engine_sample_point", n, dims, [=]() {
+        std::vector<float> point(dims);
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          engine->sample_point(i, point.data(), dims);
+          sum += point[i % dims];
+        }
+        return(sum);
+      }});
+      cases.push_back({"halton_batch", n, dims, [=]() {
+        spacefillr::halton_batch_generator gen(*random, dims);
+        std::vector<double> out(n * dims);
+        gen.generate((uint32_t)n, out.data(), n);
+        return(out[n * dims - 1]);
+      }});
+      cases.push_back({"radical_inverse", n, dims, [=]() {
+        double sum = 0;
+        for(uint64_t i = 0; i < n; i++) {
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += spacefillr::RadicalInverse(d, i);
+          }
+        }
+        return(sum);
+      }});
+      cases.push_back({"radical_inverse_batch", n, dims, [=]() {
+        spacefillr::radical_inverse_batch_generator gen(dims);
+        std::vector<spacefillr::Float> out(n * dims);
+        gen.generate(n, out.data(), n);
+        return((double)out[n * dims - 1]);
+      }});
+      cases.push_back({"sampler_blue_noise", n, dims, [=]() {
+        double sum = 0;
+        for(uint32_t i = 0; i < n; i++) {
+          const int pixel = i / 256;
+          for(uint32_t d = 0; d < dims; d++) {
+            sum += spacefillr::samplerBlueNoise(pixel & 127, pixel >> 7, i & 255, d);
+          }
+        }
+        return(sum);
+      }});
+    }
+  }
+
+  cases.push_back({"halton_random_init", 1, spacefillr::Halton_sampler::get_num_dimensions(), [=]() {
+    spacefillr::Halton_sampler hs;
+    random_gen rng(seed);
+    hs.init_random(rng.rng);
+    return((double)hs.sample(1, 1));
+  }});
+
+  for(uint64_t n : set_sizes) {
+    cases.push_back({"pj", n, 2, [=]() {
+      random_gen rng(seed);
+      return(sum_points(pmj::GetProgJitteredSamples(n, rng), n));
+    }});
+    cases.push_back({"pmj", n, 2, [=]() {
+      random_gen rng(seed);
+      return(sum_points(pmj::GetProgMultiJitteredSamples(n, rng), n));
+    }});
+    cases.push_back({"pmj02", n, 2, [=]() {
+      random_gen rng(seed);
+      return(sum_points(pmj::GetPMJ02Samples(n, rng), n));
+    }});
+  }
+  for(uint64_t n : bn_sizes) {
+    cases.push_back({"pmjbn", n, 2, [=]() {
+      random_gen rng(seed);
+      return(sum_points(pmj::GetProgMultiJitteredSamplesWithBlueNoise(n, rng), n));
+    }});
+    cases.push_back({"pmj02bn", n, 2, [=]() {
+      random_gen rng(seed);
+      return(sum_points(pmj::GetPMJ02SamplesWithBlueNoise(n, rng), n));
+    }});
+  }
+  return(cases);
+}
+
+//----------------------------------------------------------------------
+// Driver
+
+static bench_result run_case(const bench_case& c, int reps) {
+  bench_sink = bench_sink + c.run(); // warm up caches and lazily built tables
+  std::vector<double> times;
+  long long peak_heap = 0;
+  for(int r = 0; r < reps; r++) {
+    const long long live = heap_live.load();
+    heap_peak = live;
+    const auto start = std::chrono::steady_clock::now();
+    const double checksum = c.run();
+    const auto stop = std::chrono::steady_clock::now();
+    bench_sink = bench_sink + checksum;
+    times.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    peak_heap = std::max(peak_heap, heap_peak.load() - live);
+  }
+  std::sort(times.begin(), times.end());
+  bench_result result = {c, reps, times[times.size() / 2], times[0], peak_heap};
+  return(result);
+}
+
+static void write_json(FILE* f, const std::vector<bench_result>& results) {
+  std::fprintf(f, "{\n  \"benchmark\": \"spacefillr\",\n  \"results\": [\n");
+  for(size_t i = 0; i < results.size(); i++) {
+    const bench_result& r = results[i];
+    const double samples = (double)r.c.n * r.c.dims;
+    std::fprintf(f,
+      "    {\"name\": \"%s\", \"n\": %llu, \"dims\": %u, \"reps\": %d, "
+      "\"samples_per_call\": %.0f, \"median_ns_per_call\": %.1f, \"min_ns_per_call\": %.1f, "
+      "\"ns_per_sample\": %.3f, \"ns_per_point\": %.1f, \"samples_per_sec\": %.1f, "
+      "\"peak_heap_bytes\": %lld}%s\n",
+      r.c.name.c_str(), (unsigned long long)r.c.n, r.c.dims, r.reps,
+      samples, r.median_ns, r.min_ns,
+      r.median_ns / samples, r.median_ns / r.c.n, samples / (r.median_ns * 1e-9), r.peak_heap,
+      i + 1 < results.size() ? "," : "");
+  }
+  std::fprintf(f, "  ]\n}\n");
+}
+
+// Dimensions past Halton_sampler's 256 must keep every digit of the index
+// instead of repeating with period base^2.
+static bool check_halton_engine_period() {
+  spacefillr::halton_engine engine(1200);
+  engine.init_faure();
+  for(uint32_t d : {300u, 1000u, 1199u}) {
+    const uint32_t b = engine.base(d);
+    if(engine.sample_f64(d, 5) == engine.sample_f64(d, 5 + b * b)) {
+      std::fprintf(stderr, "halton_engine dimension %u repeats with period %u^2\n", d, b);
+      return(false);
+    }
+  }
+  return(true);
+}
+
+int main(int argc, char** argv) {
+  bool quick = false;
+  int reps = 5;
+  std::string filter;
+  std::string out_file;
+  for(int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if(arg == "--quick") {
+      quick = true;
+    } else if(arg == "--reps" && i + 1 < argc) {
+      reps = std::max(1, std::atoi(argv[++i]));
+    } else if(arg == "--filter" && i + 1 < argc) {
+      filter = argv[++i];
+    } else if(arg == "--out" && i + 1 < argc) {
+      out_file = argv[++i];
+    } else {
+      std::fprintf(stderr, "usage: %s [--quick] [--reps N] [--filter SUBSTRING] [--out FILE]\n", argv[0]);
+      return(1);
+    }
+  }
+
+  if(!check_halton_engine_period()) {
+    return(1);
+  }
+  std::vector<bench_result> results;
+  for(const bench_case& c : make_cases(quick)) {
+    if(!filter.empty() && c.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    results.push_back(run_case(c, reps));
+    std::fprintf(stderr, "%-22s n=%-7llu dims=%-4u %10.2f ns/sample\n", c.name.c_str(),
+                 (unsigned long long)c.n, c.dims,
+                 results.back().median_ns / ((double)c.n * c.dims));
+  }
+
+  FILE* f = out_file.empty() ? stdout : std::fopen(out_file.c_str(), "w");
+  if(!f) {
+    std::fprintf(stderr, "could not open %s\n", out_file.c_str());
+    return(1);
+  }
+  write_json(f, results);
+  if(f != stdout) {
+    std::fclose(f);
+  }
+  return(0);
+}
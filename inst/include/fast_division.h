@@ -0,0 +1,97 @@
+#ifndef FASTDIVISIONH
+#define FASTDIVISIONH
+
+#include <cstdint>
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Division by run-time invariant integers
+//
+// Halton and radical-inverse digits come from repeated division by the same
+// few bases. As in libdivide, a multiplier precomputed per divisor turns each
+// division into a multiply-high plus at most a few shifts and adds. Both
+// dividers are `constexpr`, so a divider for a template constant costs nothing
+// to set up.
+
+// High 64 bits of a * b.
+static inline uint64_t mulhi_u64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+  // __extension__ keeps -pedantic from rejecting the non-ISO type.
+  __extension__ typedef unsigned __int128 u128;
+  return (uint64_t)(((u128)a * b) >> 64);
+#else
+  const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+  const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+  return(a_hi * b_hi + (hi_lo >> 32) + (cross >> 32));
+#endif
+}
+
+// Divides 32-bit numerators by a divisor >= 2. With
+// reciprocal = ceil(2^64 / divisor), the quotient is the high half of one
+// 64-bit product and the remainder needs one more (Lemire, Kaser and Kurz,
+// "Faster Remainder by Direct Computation", 2019).
+struct fast_divider_u32 {
+  constexpr explicit fast_divider_u32(uint32_t d = 2)
+    : reciprocal(~uint64_t(0) / d + 1), divisor(d) {}
+
+  uint32_t quotient(uint32_t n) const {
+    return((uint32_t)mulhi_u64(reciprocal, n));
+  }
+
+  uint32_t remainder(uint32_t n) const {
+    return((uint32_t)mulhi_u64(reciprocal * n, divisor));
+  }
+
+  uint64_t reciprocal;
+  uint32_t divisor;
+};
+
+// Divides 64-bit numerators by a divisor >= 2, with libdivide's branch-free
+// "round up" method: for l = ceil(log2(divisor)),
+// magic = floor(2^64 * (2^l - divisor) / divisor) + 1 and
+// n / divisor = (t + ((n - t) >> 1)) >> (l - 1), where t = mulhi(magic, n).
+struct fast_divider_u64 {
+  constexpr explicit fast_divider_u64(uint64_t d = 2) : magic(0), shift(0), divisor(d) {
+    uint32_t l = 0;
+    while(l < 64 && (uint64_t(1) << l) < d) {
+      l++;
+    }
+    // 2^l - d, computed mod 2^64 so that l == 64 works too.
+    uint64_t rest = (l == 64 ? 0 : uint64_t(1) << l) - d;
+    // Long division of rest * 2^64 by d, one quotient bit at a time.
+    uint64_t q = 0;
+    for(int i = 0; i < 64; i++) {
+      const bool carry = (rest >> 63) != 0;
+      rest <<= 1;
+      q <<= 1;
+      if(carry || rest >= d) {
+        rest -= d;
+        q |= 1;
+      }
+    }
+    magic = q + 1;
+    shift = l - 1;
+  }
+
+  uint64_t quotient(uint64_t n) const {
+    const uint64_t t = mulhi_u64(magic, n);
+    return((t + ((n - t) >> 1)) >> shift);
+  }
+
+  uint64_t remainder(uint64_t n) const {
+    return(n - quotient(n) * divisor);
+  }
+
+  uint64_t magic;
+  uint32_t shift;
+  uint64_t divisor;
+};
+
+} //namespace spacefillr
+
+#endif
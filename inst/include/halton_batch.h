@@ -0,0 +1,299 @@
+#ifndef HALTONBATCHH
+#define HALTONBATCHH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "halton_engine.h"
+#include "halton_sampler.h"
+#include "low_discrepancy.h"
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Incremental Halton generation
+//
+// Going from index i to i + 1 adds one to the lowest base-b digit of i, and
+// carries into the next digit only once every b steps. Keeping the digits of
+// every dimension between calls, like an odometer, updates a radical inverse
+// with one table lookup and one multiply-add per value on average, instead of
+// extracting every digit again. The generators below produce exactly the
+// values of `Halton_sampler::sample()`/`sample_f64()` and
+// `RadicalInverse()`/`RadicalInverseF64()`. Output is column-major, as with
+// `sobol_batch_generator`: value `k` of dimension `first_dim + d` goes to
+// `out[d * stride + k]`, and each call continues where the previous one
+// stopped.
+
+// Consecutive values of the permuted Halton dimensions [first_dim,
+// first_dim + num_dims) of `hs`, which must outlive the generator. Indices
+// are 32-bit and wrap around like `sample()`'s.
+class halton_batch_generator {
+public:
+  halton_batch_generator(const Halton_sampler& hs, uint32_t num_dims, uint32_t first_dim = 0)
+    : hs_(hs), num_dims_(num_dims), first_dim_(first_dim), dims_(num_dims) {
+    if((uint64_t)first_dim + num_dims > Halton_sampler::get_num_dimensions()) {
+      throw std::runtime_error("Too many dimensions");
+    }
+    const char* tables = reinterpret_cast<const char*>(&hs);
+    for(uint32_t d = 0; d < num_dims; d++) {
+      const uint32_t dim = first_dim + d;
+      odometer& o = dims_[d];
+      if(dim == 0) {
+        continue;
+      }
+      const Halton_sampler::Point_dimension& info = Halton_sampler::point_dimensions()[dim];
+      o.perm = reinterpret_cast<const unsigned short*>(tables + info.offset);
+      o.table_size = info.table_size;
+      o.lookups = info.lookups;
+      o.scale = info.scale;
+      o.scale_f64 = Halton_sampler::dimension_info()[dim].scale;
+      o.weights[info.lookups - 1] = 1;
+      for(int k = (int)info.lookups - 2; k >= 0; k--) {
+        o.weights[k] = o.weights[k + 1] * info.table_size;
+      }
+    }
+    seek(0);
+  }
+
+  // Move to sequence index `index`. O(num_dims * lookups).
+  void seek(uint32_t index) {
+    index_ = index;
+    for(uint32_t d = 0; d < num_dims_; d++) {
+      odometer& o = dims_[d];
+      if(first_dim_ + d == 0) {
+        continue;
+      }
+      const Halton_sampler::Point_dimension& info = Halton_sampler::point_dimensions()[first_dim_ + d];
+      uint32_t rest = index;
+      o.digits = 0;
+      for(uint32_t k = 0; k < o.lookups; k++) {
+        const uint32_t quotient = info.divider.quotient(rest);
+        o.groups[k] = rest - quotient * o.table_size;
+        o.digits += o.perm[o.groups[k]] * o.weights[k];
+        rest = quotient;
+      }
+    }
+  }
+
+  uint32_t index() const { return index_; }
+  uint32_t num_dims() const { return num_dims_; }
+
+  // Same values as `sample()`.
+  void generate(uint32_t n, float* out, size_t stride) {
+    generate_impl(n, out, stride,
+                  [this](uint32_t i) { return hs_.halton2(i); },
+                  [](uint32_t digits, const odometer& o) { return float(digits) * o.scale; });
+  }
+
+  // Same values as `sample_f64()`.
+  void generate(uint32_t n, double* out, size_t stride) {
+    generate_impl(n, out, stride,
+                  [](uint32_t i) { return ReverseBits32(i) * 0x1p-32; },
+                  [](uint32_t digits, const odometer& o) { return digits * o.scale_f64; });
+  }
+
+private:
+  // Digit groups of the index in base table_size, least significant first, and
+  // the permuted value they produce, as in `sample_point()`.
+  struct odometer {
+    const unsigned short* perm = nullptr;
+    uint32_t table_size = 0;
+    uint32_t lookups = 0;
+    uint32_t groups[32];
+    uint32_t weights[32];
+    uint32_t digits = 0;
+    float scale = 0;
+    double scale_f64 = 0;
+  };
+
+  // Adds one to the index of `o`; the value wraps modulo table_size^lookups
+  // like the table lookups do.
+  static void increment(odometer& o) {
+    for(uint32_t k = 0; k < o.lookups; k++) {
+      const uint32_t old_group = o.groups[k];
+      const uint32_t group = old_group + 1 == o.table_size ? 0 : old_group + 1;
+      o.groups[k] = group;
+      o.digits += (uint32_t(o.perm[group]) - o.perm[old_group]) * o.weights[k];
+      if(group != 0) {
+        return;
+      }
+    }
+  }
+
+  template<class T, class Base2, class Convert>
+  void generate_impl(uint32_t n, T* out, size_t stride, Base2 base2, Convert convert) {
+    uint32_t written = 0;
+    while(written < n) {
+      // The 32-bit index wraps to 0, which the digits don't, so restart there.
+      const uint32_t count = (uint32_t)std::min<uint64_t>(n - written, (uint64_t(1) << 32) - index_);
+      for(uint32_t d = 0; d < num_dims_; d++) {
+        T* column = out + d * stride + written;
+        if(first_dim_ + d == 0) {
+          for(uint32_t k = 0; k < count; k++) {
+            column[k] = base2(index_ + k);
+          }
+          continue;
+        }
+        odometer o = dims_[d];
+        for(uint32_t k = 0; k < count; k++) {
+          column[k] = convert(o.digits, o);
+          increment(o);
+        }
+        dims_[d] = o;
+      }
+      written += count;
+      index_ += count;
+      if(index_ == 0) {
+        seek(0);
+      }
+    }
+  }
+
+  const Halton_sampler& hs_;
+  uint32_t num_dims_;
+  uint32_t first_dim_;
+  uint32_t index_ = 0;
+  std::vector<odometer> dims_;
+};
+
+// Consecutive values of the unpermuted radical inverses of dimensions
+// [first_dim, first_dim + num_dims). `RadicalInverse()` stops at 1024
+// dimensions; the bases here are generated on demand, so there is no limit.
+class radical_inverse_batch_generator {
+public:
+  radical_inverse_batch_generator(uint32_t num_dims, uint32_t first_dim = 0)
+    : num_dims_(num_dims), first_dim_(first_dim), dims_(num_dims) {
+    const std::vector<uint32_t> primes = first_primes(first_dim + num_dims);
+    for(uint32_t d = 0; d < num_dims; d++) {
+      odometer& o = dims_[d];
+      o.base = primes[first_dim + d];
+      // b^j and (1/b)^j, the latter multiplied out in the same order and
+      // precision as RadicalInverseSpecialized.
+      const Float inv_base = (Float)1 / (Float)o.base;
+      const double inv_base_f64 = 1.0 / (double)o.base;
+      o.powers[0] = 1;
+      o.inv_powers[0] = 1;
+      o.inv_powers_f64[0] = 1;
+      for(int j = 1; j <= MaxDigits; j++) {
+        o.powers[j] = o.powers[j - 1] * o.base;
+        o.inv_powers[j] = o.inv_powers[j - 1] * inv_base;
+        o.inv_powers_f64[j] = o.inv_powers_f64[j - 1] * inv_base_f64;
+      }
+    }
+    seek(0);
+  }
+
+  // Move to sequence index `index`. O(num_dims * digits).
+  void seek(uint64_t index) {
+    index_ = index;
+    for(uint32_t d = 0; d < num_dims_; d++) {
+      if(first_dim_ + d == 0) {
+        continue;
+      }
+      odometer& o = dims_[d];
+      const fast_divider_u64 divider(o.base);
+      o.num_digits = 0;
+      o.reversed = 0;
+      for(uint64_t rest = index; rest != 0; o.num_digits++) {
+        const uint64_t next = divider.quotient(rest);
+        o.digits[o.num_digits] = (uint32_t)(rest - next * o.base);
+        o.reversed = o.reversed * o.base + o.digits[o.num_digits];
+        rest = next;
+      }
+    }
+  }
+
+  uint64_t index() const { return index_; }
+  uint32_t num_dims() const { return num_dims_; }
+
+  // Same values as `RadicalInverse()`.
+  void generate(uint64_t n, Float* out, size_t stride) {
+    generate_impl(n, out, stride, [](uint64_t i) { return RadicalInverse(0, i); }, [](const odometer& o) {
+      return std::fmin(o.reversed * o.inv_powers[o.num_digits], RadicalInverseOneMinusEpsilon<Float>());
+    });
+  }
+
+  // Same values as `RadicalInverseF64()`.
+  void generate_f64(uint64_t n, double* out, size_t stride) {
+    generate_impl(n, out, stride, [](uint64_t i) { return RadicalInverseF64(0, i); }, [](const odometer& o) {
+      return std::fmin(o.reversed * o.inv_powers_f64[o.num_digits], RadicalInverseOneMinusEpsilon<double>());
+    });
+  }
+
+private:
+  // A 64-bit index has at most 41 digits in base 3, the smallest base kept as
+  // digits; base 2 is computed from the index directly.
+  static const int MaxDigits = 41;
+
+  // Base-b digits of the index, least significant first, and their reversal
+  // as an integer (mod 2^64, like RadicalInverseSpecialized's).
+  struct odometer {
+    uint32_t base;
+    uint32_t num_digits;
+    uint64_t reversed;
+    uint32_t digits[MaxDigits];
+    uint64_t powers[MaxDigits + 1];
+    Float inv_powers[MaxDigits + 1];
+    double inv_powers_f64[MaxDigits + 1];
+  };
+
+  static void increment(odometer& o) {
+    for(uint32_t k = 0; ; k++) {
+      if(k == o.num_digits) {
+        // A new leading digit: the index is now a power of the base.
+        o.digits[k] = 1;
+        o.num_digits++;
+        o.reversed = 1;
+        return;
+      }
+      const uint64_t weight = o.powers[o.num_digits - 1 - k];
+      if(o.digits[k] + 1 < o.base) {
+        o.digits[k]++;
+        o.reversed += weight;
+        return;
+      }
+      o.reversed -= (o.base - 1) * weight;
+      o.digits[k] = 0;
+    }
+  }
+
+  template<class T, class Base2, class Convert>
+  void generate_impl(uint64_t n, T* out, size_t stride, Base2 base2, Convert convert) {
+    uint64_t written = 0;
+    while(written < n) {
+      // As in halton_batch_generator, restart the digits where the index wraps.
+      const uint64_t count = index_ == 0 ? n - written : std::min(n - written, 0 - index_);
+      for(uint32_t d = 0; d < num_dims_; d++) {
+        T* column = out + d * stride + written;
+        if(first_dim_ + d == 0) {
+          for(uint64_t k = 0; k < count; k++) {
+            column[k] = base2(index_ + k);
+          }
+          continue;
+        }
+        odometer& o = dims_[d];
+        for(uint64_t k = 0; k < count; k++) {
+          column[k] = convert(o);
+          increment(o);
+        }
+      }
+      written += count;
+      index_ += count;
+      if(index_ == 0) {
+        seek(0);
+      }
+    }
+  }
+
+  uint32_t num_dims_;
+  uint32_t first_dim_;
+  uint64_t index_ = 0;
+  std::vector<odometer> dims_;
+};
+
+} //namespace spacefillr
+
+#endif
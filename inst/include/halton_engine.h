@@ -0,0 +1,311 @@
+#ifndef HALTONENGINEH
+#define HALTONENGINEH
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "fast_division.h"
+#include "low_discrepancy.h"
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Run-time sized Halton sequences
+//
+// `Halton_sampler` is generated code with one permutation table member per
+// base, so it stops at 256 dimensions. `halton_engine` builds the same kind
+// of tables for any number of dimensions when it is constructed: the primes
+// are generated on demand and every dimension's table lives in one contiguous
+// arena. Each table maps a group of digits of the index to its permuted,
+// reversed digits, exactly like the `haltonNNN` methods, so the first 256
+// dimensions of `init_faure()` are identical to `Halton_sampler`'s, and so are
+// those of `init_random()` given the same generator state.
+//
+// The arena is packed for `sample_point()`, which walks the dimensions in
+// order: tables are stored dimension after dimension with no padding beyond
+// their element alignment, and each uses the narrowest entry type that holds
+// its values, i.e. one byte while the table size is at most 256 (a single
+// digit of a base below 256) and two up to 65536. The first 60 dimensions, a
+// typical renderer's working set, take 12 KB instead of the 19 KB they span in
+// `Halton_sampler`, so they stay in L1. Past dimension 8 a table has one entry
+// per digit of its base, so the arena grows with the sum of the bases: about
+// 11 MB for 1200 dimensions. The arena is immutable once initialized and
+// shared between copies of the engine, so threads can each hold a copy
+// without duplicating the tables.
+
+// The first `count` primes (2, 3, 5, ...), the bases of the Halton dimensions.
+static inline std::vector<uint32_t> first_primes(uint32_t count) {
+  std::vector<uint32_t> primes;
+  primes.reserve(count);
+  for(uint32_t candidate = 2; primes.size() < count; candidate++) {
+    bool is_prime = true;
+    for(uint32_t p : primes) {
+      if(p * p > candidate) {
+        break;
+      }
+      if(candidate % p == 0) {
+        is_prime = false;
+        break;
+      }
+    }
+    if(is_prime) {
+      primes.push_back(candidate);
+    }
+  }
+  return(primes);
+}
+
+class halton_engine {
+public:
+  explicit halton_engine(uint32_t num_dims)
+    : dims_(num_dims), bases_(first_primes(num_dims)), scales_f64_(num_dims) {
+    size_t arena_size = 0;
+    for(uint32_t d = 0; d < num_dims; d++) {
+      dimension& dim = dims_[d];
+      if(d == 0) {
+        // Base 2 is a bit reversal and has no table.
+        dim.scale = 0x1p-23f;
+        scales_f64_[d] = 0x1p-32;
+        continue;
+      }
+      uint32_t table_digits, lookups;
+      table_layout(bases_[d], table_digits, lookups);
+      uint32_t table_size = 1;
+      for(uint32_t k = 0; k < table_digits; k++) {
+        table_size *= bases_[d];
+      }
+      uint64_t total = 1;
+      for(uint32_t k = 0; k < lookups; k++) {
+        total *= table_size;
+      }
+      dim.divider = fast_divider_u32(table_size);
+      dim.scale = float(0x1.fffffcp-1 / total);
+      dim.lookups = (uint8_t)lookups;
+      dim.entry_bytes = table_size <= 0x100 ? 1 : table_size <= 0x10000 ? 2 : 4;
+      scales_f64_[d] = 1.0 / total;
+      arena_size = (arena_size + dim.entry_bytes - 1) / dim.entry_bytes * dim.entry_bytes;
+      dim.offset = arena_size;
+      arena_size += (size_t)table_size * dim.entry_bytes;
+    }
+    // 64-bit words keep every table aligned for its entry type.
+    arena_ = std::make_shared<const std::vector<uint64_t> >((arena_size + 7) / 8, 0);
+  }
+
+  // Faure permutations, as `Halton_sampler::init_faure()`.
+  void init_faure() {
+    std::shared_ptr<std::vector<uint64_t> > arena = std::make_shared<std::vector<uint64_t> >(arena_->size());
+    std::map<uint32_t, std::vector<uint32_t> > cache;
+    for(uint32_t d = 1; d < num_dims(); d++) {
+      init_table(*arena, d, faure_permutation(bases_[d], cache));
+    }
+    arena_ = arena;
+  }
+
+  // Random permutations. `rand` is used as by `Halton_sampler::init_random()`,
+  // which shuffles every base from 4 to 1619, primes or not; past 1619 only
+  // the prime bases are shuffled, so that large dimension counts don't cost
+  // O(base^2).
+  template <typename Random_number_generator>
+  void init_random(Random_number_generator& rand) {
+    const uint32_t compatible_bases = 1619;
+    std::shared_ptr<std::vector<uint64_t> > arena = std::make_shared<std::vector<uint64_t> >(arena_->size());
+    std::vector<uint32_t> perm;
+    uint32_t d = 1;
+    for(uint32_t base = 2; d < num_dims(); base++) {
+      const bool is_base = bases_[d] == base;
+      if(base > compatible_bases && !is_base) {
+        continue;
+      }
+      perm.resize(base);
+      std::iota(perm.begin(), perm.end(), 0u);
+      if(base > 3) {
+        std::shuffle(perm.begin(), perm.end(), rand);
+      }
+      if(is_base) {
+        init_table(*arena, d++, perm);
+      }
+    }
+    arena_ = arena;
+  }
+
+  uint32_t num_dims() const { return (uint32_t)dims_.size(); }
+  uint32_t base(uint32_t dim) const { return bases_[dim]; }
+
+  // Bytes of permutation tables, shared by all copies of this engine.
+  size_t table_bytes() const { return arena_->size() * sizeof(uint64_t); }
+
+  // Same as `Halton_sampler::sample()` for the first 256 dimensions. Dimensions
+  // past num_dims() return 0.
+  float sample(uint32_t dim, uint32_t index) const {
+    if(dim >= num_dims()) {
+      return 0.f;
+    }
+    if(dim == 0) {
+      return (ReverseBits32(index) >> 9) * dims_[0].scale;
+    }
+    return float(digits(dims_[dim], index)) * dims_[dim].scale;
+  }
+
+  // Same as `Halton_sampler::sample_f64()` for the first 256 dimensions.
+  double sample_f64(uint32_t dim, uint32_t index) const {
+    if(dim >= num_dims()) {
+      return 0.0;
+    }
+    if(dim == 0) {
+      return ReverseBits32(index) * scales_f64_[0];
+    }
+    // Past 2^53 the digits can round up to table_size^lookups.
+    return std::min(digits(dims_[dim], index) * scales_f64_[dim], 0x1.fffffffffffffp-1);
+  }
+
+  // Writes sample(d, index) for d = 0 .. n - 1 to out[d].
+  void sample_point(uint32_t index, float* out, uint32_t n) const {
+    const uint32_t count = std::min(n, num_dims());
+    if(count > 0) {
+      out[0] = sample(0, index);
+    }
+    const char* arena = reinterpret_cast<const char*>(arena_->data());
+    for(uint32_t d = 1; d < count; d++) {
+      const dimension& dim = dims_[d];
+      out[d] = float(digits(dim, arena + dim.offset, index)) * dim.scale;
+    }
+    for(uint32_t d = count; d < n; d++) {
+      out[d] = 0.f;
+    }
+  }
+
+private:
+  // What sample_point() reads per dimension, in 32 bytes. The divisor of
+  // `divider` is the table size.
+  struct dimension {
+    fast_divider_u32 divider;
+    // Byte offset of the table in the arena.
+    size_t offset = 0;
+    float scale = 0;
+    uint8_t lookups = 0;
+    uint8_t entry_bytes = 0;
+  };
+
+  // Base-b digits per table and table lookups per sample. The small bases use
+  // the hand-picked layout of `Halton_sampler`; from 23 on, each table covers
+  // one digit. Up to base 1619, the last of `Halton_sampler`, a sample uses as
+  // many digits as fit in 32 bits, like the `haltonNNN` methods. Past it that
+  // would be at most two digits and every dimension would repeat with period
+  // base^2, so a sample uses enough digits to cover every 32-bit index.
+  static void table_layout(uint32_t base, uint32_t& table_digits, uint32_t& lookups) {
+    static const uint32_t small[7][3] = {
+      {3, 5, 4}, {5, 3, 4}, {7, 3, 3}, {11, 2, 4}, {13, 2, 4}, {17, 2, 3}, {19, 2, 3}
+    };
+    for(const uint32_t* layout : small) {
+      if(layout[0] == base) {
+        table_digits = layout[1];
+        lookups = layout[2];
+        return;
+      }
+    }
+    table_digits = 1;
+    lookups = 0;
+    if(base > 1619) {
+      for(uint64_t total = 1; total < 0x100000000ull; total *= base) {
+        lookups++;
+      }
+      return;
+    }
+    for(uint64_t total = base; total <= 0x100000000ull; total *= base) {
+      lookups++;
+    }
+  }
+
+  // The Faure permutation of `base`, built from those of base - 1 (odd bases)
+  // or base / 2 (even bases), as in `Halton_sampler::init_faure()`. `cache`
+  // keeps the permutations built so far.
+  static const std::vector<uint32_t>& faure_permutation(uint32_t base,
+                                                        std::map<uint32_t, std::vector<uint32_t> >& cache) {
+    auto it = cache.find(base);
+    if(it != cache.end()) {
+      return it->second;
+    }
+    std::vector<uint32_t> perm(base);
+    if(base <= 3) {
+      std::iota(perm.begin(), perm.end(), 0u);
+    } else if(base & 1) {
+      const std::vector<uint32_t>& prev = faure_permutation(base - 1, cache);
+      const uint32_t b = base / 2;
+      for(uint32_t i = 0; i < base - 1; i++) {
+        perm[i + (i >= b)] = prev[i] + (prev[i] >= b);
+      }
+      perm[b] = b;
+    } else {
+      const std::vector<uint32_t>& half = faure_permutation(base / 2, cache);
+      const uint32_t b = base / 2;
+      for(uint32_t i = 0; i < b; i++) {
+        perm[i] = 2 * half[i];
+        perm[b + i] = 2 * half[i] + 1;
+      }
+    }
+    return cache.emplace(base, std::move(perm)).first->second;
+  }
+
+  // Entry i of the table is i's table_digits base-b digits, permuted and in
+  // reverse order.
+  void init_table(std::vector<uint64_t>& arena, uint32_t d, const std::vector<uint32_t>& perm) const {
+    const dimension& dim = dims_[d];
+    const uint32_t base = bases_[d];
+    uint32_t table_digits, lookups;
+    table_layout(base, table_digits, lookups);
+    char* table = reinterpret_cast<char*>(arena.data()) + dim.offset;
+    for(uint32_t i = 0; i < dim.divider.divisor; i++) {
+      uint32_t rest = i;
+      uint32_t result = 0;
+      for(uint32_t k = 0; k < table_digits; k++) {
+        result = result * base + perm[rest % base];
+        rest /= base;
+      }
+      switch(dim.entry_bytes) {
+        case 1: reinterpret_cast<uint8_t*>(table)[i] = (uint8_t)result; break;
+        case 2: reinterpret_cast<uint16_t*>(table)[i] = (uint16_t)result; break;
+        default: reinterpret_cast<uint32_t*>(table)[i] = result; break;
+      }
+    }
+  }
+
+  uint64_t digits(const dimension& dim, uint32_t index) const {
+    return digits(dim, reinterpret_cast<const char*>(arena_->data()) + dim.offset, index);
+  }
+
+  static uint64_t digits(const dimension& dim, const char* table, uint32_t index) {
+    switch(dim.entry_bytes) {
+      case 1: return digits(dim, reinterpret_cast<const uint8_t*>(table), index);
+      case 2: return digits(dim, reinterpret_cast<const uint16_t*>(table), index);
+      default: return digits(dim, reinterpret_cast<const uint32_t*>(table), index);
+    }
+  }
+
+  // The permuted digits as an integer below table_size^lookups, which is at
+  // most 2^32 up to base 1619 and below 2^64 past it.
+  template<class T>
+  static uint64_t digits(const dimension& dim, const T* table, uint32_t index) {
+    uint64_t result = 0;
+    for(uint32_t k = 0; k < dim.lookups; k++) {
+      const uint32_t quotient = dim.divider.quotient(index);
+      result = result * dim.divider.divisor + table[index - quotient * dim.divider.divisor];
+      index = quotient;
+    }
+    return result;
+  }
+
+  std::vector<dimension> dims_;
+  std::vector<uint32_t> bases_;
+  std::vector<double> scales_f64_;
+  std::shared_ptr<const std::vector<uint64_t> > arena_;
+};
+
+} //namespace spacefillr
+
+#endif
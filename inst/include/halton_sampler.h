@@ -24,9 +24,20 @@
 #define HALTON_SAMPLER_H
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "fast_division.h"
+#include "rng.h"
+
 namespace spacefillr {
+class halton_batch_generator;
+
 // Compute points of the Halton sequence with with digit-permutations for different bases.
 class Halton_sampler
 {
@@ -51,7 +62,45 @@ public:
     // dimension must be smaller than the value returned by get_num_dimensions().
     float sample(unsigned dimension, unsigned index) const;
 
+    // Same as sample(), but in double precision. The permuted digits are accumulated as an
+    // integer of up to 32 bits, all of which are kept in the result.
+    double sample_f64(unsigned dimension, unsigned index) const;
+
+    // Writes sample(d, index) for d = 0 .. num_dimensions - 1 to out[d]. All dimensions are
+    // evaluated in one loop over a per-dimension table instead of one call through the switch of
+    // sample() each, and the digits are extracted with precomputed reciprocals instead of
+    // divisions. Dimensions past get_num_dimensions() are set to 0, like sample() does.
+    void sample_point(unsigned index, float* out, unsigned num_dimensions) const;
+
 private:
+    friend class halton_batch_generator;
+
+    // Layout of the permutation table of each dimension: the prime base, the table size
+    // (a power of the base), the number of table lookups per sample, the table's offset in
+    // the object and 1 / table_size^lookups. Base 2 has no table.
+    struct Dimension_info
+    {
+        unsigned base;
+        unsigned table_size;
+        unsigned lookups;
+        size_t offset;
+        double scale;
+    };
+    static const Dimension_info* dimension_info();
+
+    // Constants of sample_point() and sample_f64() for each dimension, derived from
+    // dimension_info(): the table layout, a divider for the table size and the float scale of
+    // sample().
+    struct Point_dimension
+    {
+        size_t offset;
+        unsigned table_size;
+        unsigned lookups;
+        fast_divider_u32 divider;
+        float scale;
+    };
+    static const Point_dimension* point_dimensions();
+
     static unsigned short invert(unsigned short base, unsigned short digits,
         unsigned short index, const std::vector<unsigned short>& perm);
 
@@ -888,6 +937,344 @@ inline float Halton_sampler::sample(const unsigned dimension, const unsigned ind
     return 0.f;
 }
 
+inline double Halton_sampler::sample_f64(const unsigned dimension, unsigned index) const
+{
+    if (dimension >= get_num_dimensions())
+        return 0.0;
+    const Dimension_info& info = dimension_info()[dimension];
+    if (dimension == 0) // Base 2: bit reversal, exact in double.
+    {
+        index = (index << 16) | (index >> 16);
+        index = ((index & 0x00ff00ff) << 8) | ((index & 0xff00ff00) >> 8);
+        index = ((index & 0x0f0f0f0f) << 4) | ((index & 0xf0f0f0f0) >> 4);
+        index = ((index & 0x33333333) << 2) | ((index & 0xcccccccc) >> 2);
+        index = ((index & 0x55555555) << 1) | ((index & 0xaaaaaaaa) >> 1);
+        return index * info.scale;
+    }
+    const Point_dimension& dim = point_dimensions()[dimension];
+    const unsigned short* perm =
+        reinterpret_cast<const unsigned short*>(reinterpret_cast<const char*>(this) + info.offset);
+    unsigned long long digits = 0;
+    for (unsigned i = 0; i < info.lookups; ++i)
+    {
+        const unsigned quotient = dim.divider.quotient(index);
+        digits = digits * info.table_size + perm[index - quotient * info.table_size];
+        index = quotient;
+    }
+    return digits * info.scale; // Results in [0,1).
+}
+
+inline void Halton_sampler::sample_point(const unsigned index, float* out,
+    const unsigned num_dimensions) const
+{
+    const unsigned n = std::min(num_dimensions, get_num_dimensions());
+    if (n > 0)
+        out[0] = halton2(index);
+    const Point_dimension* dims = point_dimensions();
+    const char* tables = reinterpret_cast<const char*>(this);
+    for (unsigned d = 1; d < n; ++d)
+    {
+        const Point_dimension& dim = dims[d];
+        const unsigned short* perm = reinterpret_cast<const unsigned short*>(tables + dim.offset);
+        unsigned rest = index;
+        unsigned digits = 0;
+        for (unsigned i = 0; i < dim.lookups; ++i)
+        {
+            const unsigned quotient = dim.divider.quotient(rest);
+            digits = digits * dim.table_size + perm[rest - quotient * dim.table_size];
+            rest = quotient;
+        }
+        out[d] = float(digits) * dim.scale;
+    }
+    for (unsigned d = n; d < num_dimensions; ++d)
+        out[d] = 0.f;
+}
+
+inline const Halton_sampler::Point_dimension* Halton_sampler::point_dimensions()
+{
+    static const std::vector<Point_dimension> dims = []() {
+        std::vector<Point_dimension> result(get_num_dimensions());
+        for (unsigned d = 1; d < get_num_dimensions(); ++d)
+        {
+            const Dimension_info& info = dimension_info()[d];
+            Point_dimension& dim = result[d];
+            dim.offset = info.offset;
+            dim.table_size = info.table_size;
+            dim.lookups = info.lookups;
+            dim.divider = fast_divider_u32(info.table_size);
+            unsigned long long total = 1;
+            for (unsigned i = 0; i < info.lookups; ++i)
+                total *= info.table_size;
+            dim.scale = float(0x1.fffffcp-1 / total); // Same as the haltonNNN methods.
+        }
+        return result;
+    }();
+    return dims.data();
+}
+
+inline const Halton_sampler::Dimension_info* Halton_sampler::dimension_info()
+{
+    static const Dimension_info info[256] = {
+        {2u, 0u, 0u, 0, 0x1p-32},
+        {3u, 243u, 4u, offsetof(Halton_sampler, m_perm3), 1.0 / 3486784401u},
+        {5u, 125u, 4u, offsetof(Halton_sampler, m_perm5), 1.0 / 244140625u},
+        {7u, 343u, 3u, offsetof(Halton_sampler, m_perm7), 1.0 / 40353607u},
+        {11u, 121u, 4u, offsetof(Halton_sampler, m_perm11), 1.0 / 214358881u},
+        {13u, 169u, 4u, offsetof(Halton_sampler, m_perm13), 1.0 / 815730721u},
+        {17u, 289u, 3u, offsetof(Halton_sampler, m_perm17), 1.0 / 24137569u},
+        {19u, 361u, 3u, offsetof(Halton_sampler, m_perm19), 1.0 / 47045881u},
+        {23u, 23u, 7u, offsetof(Halton_sampler, m_perm23), 1.0 / 3404825447u},
+        {29u, 29u, 6u, offsetof(Halton_sampler, m_perm29), 1.0 / 594823321u},
+        {31u, 31u, 6u, offsetof(Halton_sampler, m_perm31), 1.0 / 887503681u},
+        {37u, 37u, 6u, offsetof(Halton_sampler, m_perm37), 1.0 / 2565726409u},
+        {41u, 41u, 5u, offsetof(Halton_sampler, m_perm41), 1.0 / 115856201u},
+        {43u, 43u, 5u, offsetof(Halton_sampler, m_perm43), 1.0 / 147008443u},
+        {47u, 47u, 5u, offsetof(Halton_sampler, m_perm47), 1.0 / 229345007u},
+        {53u, 53u, 5u, offsetof(Halton_sampler, m_perm53), 1.0 / 418195493u},
+        {59u, 59u, 5u, offsetof(Halton_sampler, m_perm59), 1.0 / 714924299u},
+        {61u, 61u, 5u, offsetof(Halton_sampler, m_perm61), 1.0 / 844596301u},
+        {67u, 67u, 5u, offsetof(Halton_sampler, m_perm67), 1.0 / 1350125107u},
+        {71u, 71u, 5u, offsetof(Halton_sampler, m_perm71), 1.0 / 1804229351u},
+        {73u, 73u, 5u, offsetof(Halton_sampler, m_perm73), 1.0 / 2073071593u},
+        {79u, 79u, 5u, offsetof(Halton_sampler, m_perm79), 1.0 / 3077056399u},
+        {83u, 83u, 5u, offsetof(Halton_sampler, m_perm83), 1.0 / 3939040643u},
+        {89u, 89u, 4u, offsetof(Halton_sampler, m_perm89), 1.0 / 62742241u},
+        {97u, 97u, 4u, offsetof(Halton_sampler, m_perm97), 1.0 / 88529281u},
+        {101u, 101u, 4u, offsetof(Halton_sampler, m_perm101), 1.0 / 104060401u},
+        {103u, 103u, 4u, offsetof(Halton_sampler, m_perm103), 1.0 / 112550881u},
+        {107u, 107u, 4u, offsetof(Halton_sampler, m_perm107), 1.0 / 131079601u},
+        {109u, 109u, 4u, offsetof(Halton_sampler, m_perm109), 1.0 / 141158161u},
+        {113u, 113u, 4u, offsetof(Halton_sampler, m_perm113), 1.0 / 163047361u},
+        {127u, 127u, 4u, offsetof(Halton_sampler, m_perm127), 1.0 / 260144641u},
+        {131u, 131u, 4u, offsetof(Halton_sampler, m_perm131), 1.0 / 294499921u},
+        {137u, 137u, 4u, offsetof(Halton_sampler, m_perm137), 1.0 / 352275361u},
+        {139u, 139u, 4u, offsetof(Halton_sampler, m_perm139), 1.0 / 373301041u},
+        {149u, 149u, 4u, offsetof(Halton_sampler, m_perm149), 1.0 / 492884401u},
+        {151u, 151u, 4u, offsetof(Halton_sampler, m_perm151), 1.0 / 519885601u},
+        {157u, 157u, 4u, offsetof(Halton_sampler, m_perm157), 1.0 / 607573201u},
+        {163u, 163u, 4u, offsetof(Halton_sampler, m_perm163), 1.0 / 705911761u},
+        {167u, 167u, 4u, offsetof(Halton_sampler, m_perm167), 1.0 / 777796321u},
+        {173u, 173u, 4u, offsetof(Halton_sampler, m_perm173), 1.0 / 895745041u},
+        {179u, 179u, 4u, offsetof(Halton_sampler, m_perm179), 1.0 / 1026625681u},
+        {181u, 181u, 4u, offsetof(Halton_sampler, m_perm181), 1.0 / 1073283121u},
+        {191u, 191u, 4u, offsetof(Halton_sampler, m_perm191), 1.0 / 1330863361u},
+        {193u, 193u, 4u, offsetof(Halton_sampler, m_perm193), 1.0 / 1387488001u},
+        {197u, 197u, 4u, offsetof(Halton_sampler, m_perm197), 1.0 / 1506138481u},
+        {199u, 199u, 4u, offsetof(Halton_sampler, m_perm199), 1.0 / 1568239201u},
+        {211u, 211u, 4u, offsetof(Halton_sampler, m_perm211), 1.0 / 1982119441u},
+        {223u, 223u, 4u, offsetof(Halton_sampler, m_perm223), 1.0 / 2472973441u},
+        {227u, 227u, 4u, offsetof(Halton_sampler, m_perm227), 1.0 / 2655237841u},
+        {229u, 229u, 4u, offsetof(Halton_sampler, m_perm229), 1.0 / 2750058481u},
+        {233u, 233u, 4u, offsetof(Halton_sampler, m_perm233), 1.0 / 2947295521u},
+        {239u, 239u, 4u, offsetof(Halton_sampler, m_perm239), 1.0 / 3262808641u},
+        {241u, 241u, 4u, offsetof(Halton_sampler, m_perm241), 1.0 / 3373402561u},
+        {251u, 251u, 4u, offsetof(Halton_sampler, m_perm251), 1.0 / 3969126001u},
+        {257u, 257u, 3u, offsetof(Halton_sampler, m_perm257), 1.0 / 16974593u},
+        {263u, 263u, 3u, offsetof(Halton_sampler, m_perm263), 1.0 / 18191447u},
+        {269u, 269u, 3u, offsetof(Halton_sampler, m_perm269), 1.0 / 19465109u},
+        {271u, 271u, 3u, offsetof(Halton_sampler, m_perm271), 1.0 / 19902511u},
+        {277u, 277u, 3u, offsetof(Halton_sampler, m_perm277), 1.0 / 21253933u},
+        {281u, 281u, 3u, offsetof(Halton_sampler, m_perm281), 1.0 / 22188041u},
+        {283u, 283u, 3u, offsetof(Halton_sampler, m_perm283), 1.0 / 22665187u},
+        {293u, 293u, 3u, offsetof(Halton_sampler, m_perm293), 1.0 / 25153757u},
+        {307u, 307u, 3u, offsetof(Halton_sampler, m_perm307), 1.0 / 28934443u},
+        {311u, 311u, 3u, offsetof(Halton_sampler, m_perm311), 1.0 / 30080231u},
+        {313u, 313u, 3u, offsetof(Halton_sampler, m_perm313), 1.0 / 30664297u},
+        {317u, 317u, 3u, offsetof(Halton_sampler, m_perm317), 1.0 / 31855013u},
+        {331u, 331u, 3u, offsetof(Halton_sampler, m_perm331), 1.0 / 36264691u},
+        {337u, 337u, 3u, offsetof(Halton_sampler, m_perm337), 1.0 / 38272753u},
+        {347u, 347u, 3u, offsetof(Halton_sampler, m_perm347), 1.0 / 41781923u},
+        {349u, 349u, 3u, offsetof(Halton_sampler, m_perm349), 1.0 / 42508549u},
+        {353u, 353u, 3u, offsetof(Halton_sampler, m_perm353), 1.0 / 43986977u},
+        {359u, 359u, 3u, offsetof(Halton_sampler, m_perm359), 1.0 / 46268279u},
+        {367u, 367u, 3u, offsetof(Halton_sampler, m_perm367), 1.0 / 49430863u},
+        {373u, 373u, 3u, offsetof(Halton_sampler, m_perm373), 1.0 / 51895117u},
+        {379u, 379u, 3u, offsetof(Halton_sampler, m_perm379), 1.0 / 54439939u},
+        {383u, 383u, 3u, offsetof(Halton_sampler, m_perm383), 1.0 / 56181887u},
+        {389u, 389u, 3u, offsetof(Halton_sampler, m_perm389), 1.0 / 58863869u},
+        {397u, 397u, 3u, offsetof(Halton_sampler, m_perm397), 1.0 / 62570773u},
+        {401u, 401u, 3u, offsetof(Halton_sampler, m_perm401), 1.0 / 64481201u},
+        {409u, 409u, 3u, offsetof(Halton_sampler, m_perm409), 1.0 / 68417929u},
+        {419u, 419u, 3u, offsetof(Halton_sampler, m_perm419), 1.0 / 73560059u},
+        {421u, 421u, 3u, offsetof(Halton_sampler, m_perm421), 1.0 / 74618461u},
+        {431u, 431u, 3u, offsetof(Halton_sampler, m_perm431), 1.0 / 80062991u},
+        {433u, 433u, 3u, offsetof(Halton_sampler, m_perm433), 1.0 / 81182737u},
+        {439u, 439u, 3u, offsetof(Halton_sampler, m_perm439), 1.0 / 84604519u},
+        {443u, 443u, 3u, offsetof(Halton_sampler, m_perm443), 1.0 / 86938307u},
+        {449u, 449u, 3u, offsetof(Halton_sampler, m_perm449), 1.0 / 90518849u},
+        {457u, 457u, 3u, offsetof(Halton_sampler, m_perm457), 1.0 / 95443993u},
+        {461u, 461u, 3u, offsetof(Halton_sampler, m_perm461), 1.0 / 97972181u},
+        {463u, 463u, 3u, offsetof(Halton_sampler, m_perm463), 1.0 / 99252847u},
+        {467u, 467u, 3u, offsetof(Halton_sampler, m_perm467), 1.0 / 101847563u},
+        {479u, 479u, 3u, offsetof(Halton_sampler, m_perm479), 1.0 / 109902239u},
+        {487u, 487u, 3u, offsetof(Halton_sampler, m_perm487), 1.0 / 115501303u},
+        {491u, 491u, 3u, offsetof(Halton_sampler, m_perm491), 1.0 / 118370771u},
+        {499u, 499u, 3u, offsetof(Halton_sampler, m_perm499), 1.0 / 124251499u},
+        {503u, 503u, 3u, offsetof(Halton_sampler, m_perm503), 1.0 / 127263527u},
+        {509u, 509u, 3u, offsetof(Halton_sampler, m_perm509), 1.0 / 131872229u},
+        {521u, 521u, 3u, offsetof(Halton_sampler, m_perm521), 1.0 / 141420761u},
+        {523u, 523u, 3u, offsetof(Halton_sampler, m_perm523), 1.0 / 143055667u},
+        {541u, 541u, 3u, offsetof(Halton_sampler, m_perm541), 1.0 / 158340421u},
+        {547u, 547u, 3u, offsetof(Halton_sampler, m_perm547), 1.0 / 163667323u},
+        {557u, 557u, 3u, offsetof(Halton_sampler, m_perm557), 1.0 / 172808693u},
+        {563u, 563u, 3u, offsetof(Halton_sampler, m_perm563), 1.0 / 178453547u},
+        {569u, 569u, 3u, offsetof(Halton_sampler, m_perm569), 1.0 / 184220009u},
+        {571u, 571u, 3u, offsetof(Halton_sampler, m_perm571), 1.0 / 186169411u},
+        {577u, 577u, 3u, offsetof(Halton_sampler, m_perm577), 1.0 / 192100033u},
+        {587u, 587u, 3u, offsetof(Halton_sampler, m_perm587), 1.0 / 202262003u},
+        {593u, 593u, 3u, offsetof(Halton_sampler, m_perm593), 1.0 / 208527857u},
+        {599u, 599u, 3u, offsetof(Halton_sampler, m_perm599), 1.0 / 214921799u},
+        {601u, 601u, 3u, offsetof(Halton_sampler, m_perm601), 1.0 / 217081801u},
+        {607u, 607u, 3u, offsetof(Halton_sampler, m_perm607), 1.0 / 223648543u},
+        {613u, 613u, 3u, offsetof(Halton_sampler, m_perm613), 1.0 / 230346397u},
+        {617u, 617u, 3u, offsetof(Halton_sampler, m_perm617), 1.0 / 234885113u},
+        {619u, 619u, 3u, offsetof(Halton_sampler, m_perm619), 1.0 / 237176659u},
+        {631u, 631u, 3u, offsetof(Halton_sampler, m_perm631), 1.0 / 251239591u},
+        {641u, 641u, 3u, offsetof(Halton_sampler, m_perm641), 1.0 / 263374721u},
+        {643u, 643u, 3u, offsetof(Halton_sampler, m_perm643), 1.0 / 265847707u},
+        {647u, 647u, 3u, offsetof(Halton_sampler, m_perm647), 1.0 / 270840023u},
+        {653u, 653u, 3u, offsetof(Halton_sampler, m_perm653), 1.0 / 278445077u},
+        {659u, 659u, 3u, offsetof(Halton_sampler, m_perm659), 1.0 / 286191179u},
+        {661u, 661u, 3u, offsetof(Halton_sampler, m_perm661), 1.0 / 288804781u},
+        {673u, 673u, 3u, offsetof(Halton_sampler, m_perm673), 1.0 / 304821217u},
+        {677u, 677u, 3u, offsetof(Halton_sampler, m_perm677), 1.0 / 310288733u},
+        {683u, 683u, 3u, offsetof(Halton_sampler, m_perm683), 1.0 / 318611987u},
+        {691u, 691u, 3u, offsetof(Halton_sampler, m_perm691), 1.0 / 329939371u},
+        {701u, 701u, 3u, offsetof(Halton_sampler, m_perm701), 1.0 / 344472101u},
+        {709u, 709u, 3u, offsetof(Halton_sampler, m_perm709), 1.0 / 356400829u},
+        {719u, 719u, 3u, offsetof(Halton_sampler, m_perm719), 1.0 / 371694959u},
+        {727u, 727u, 3u, offsetof(Halton_sampler, m_perm727), 1.0 / 384240583u},
+        {733u, 733u, 3u, offsetof(Halton_sampler, m_perm733), 1.0 / 393832837u},
+        {739u, 739u, 3u, offsetof(Halton_sampler, m_perm739), 1.0 / 403583419u},
+        {743u, 743u, 3u, offsetof(Halton_sampler, m_perm743), 1.0 / 410172407u},
+        {751u, 751u, 3u, offsetof(Halton_sampler, m_perm751), 1.0 / 423564751u},
+        {757u, 757u, 3u, offsetof(Halton_sampler, m_perm757), 1.0 / 433798093u},
+        {761u, 761u, 3u, offsetof(Halton_sampler, m_perm761), 1.0 / 440711081u},
+        {769u, 769u, 3u, offsetof(Halton_sampler, m_perm769), 1.0 / 454756609u},
+        {773u, 773u, 3u, offsetof(Halton_sampler, m_perm773), 1.0 / 461889917u},
+        {787u, 787u, 3u, offsetof(Halton_sampler, m_perm787), 1.0 / 487443403u},
+        {797u, 797u, 3u, offsetof(Halton_sampler, m_perm797), 1.0 / 506261573u},
+        {809u, 809u, 3u, offsetof(Halton_sampler, m_perm809), 1.0 / 529475129u},
+        {811u, 811u, 3u, offsetof(Halton_sampler, m_perm811), 1.0 / 533411731u},
+        {821u, 821u, 3u, offsetof(Halton_sampler, m_perm821), 1.0 / 553387661u},
+        {823u, 823u, 3u, offsetof(Halton_sampler, m_perm823), 1.0 / 557441767u},
+        {827u, 827u, 3u, offsetof(Halton_sampler, m_perm827), 1.0 / 565609283u},
+        {829u, 829u, 3u, offsetof(Halton_sampler, m_perm829), 1.0 / 569722789u},
+        {839u, 839u, 3u, offsetof(Halton_sampler, m_perm839), 1.0 / 590589719u},
+        {853u, 853u, 3u, offsetof(Halton_sampler, m_perm853), 1.0 / 620650477u},
+        {857u, 857u, 3u, offsetof(Halton_sampler, m_perm857), 1.0 / 629422793u},
+        {859u, 859u, 3u, offsetof(Halton_sampler, m_perm859), 1.0 / 633839779u},
+        {863u, 863u, 3u, offsetof(Halton_sampler, m_perm863), 1.0 / 642735647u},
+        {877u, 877u, 3u, offsetof(Halton_sampler, m_perm877), 1.0 / 674526133u},
+        {881u, 881u, 3u, offsetof(Halton_sampler, m_perm881), 1.0 / 683797841u},
+        {883u, 883u, 3u, offsetof(Halton_sampler, m_perm883), 1.0 / 688465387u},
+        {887u, 887u, 3u, offsetof(Halton_sampler, m_perm887), 1.0 / 697864103u},
+        {907u, 907u, 3u, offsetof(Halton_sampler, m_perm907), 1.0 / 746142643u},
+        {911u, 911u, 3u, offsetof(Halton_sampler, m_perm911), 1.0 / 756058031u},
+        {919u, 919u, 3u, offsetof(Halton_sampler, m_perm919), 1.0 / 776151559u},
+        {929u, 929u, 3u, offsetof(Halton_sampler, m_perm929), 1.0 / 801765089u},
+        {937u, 937u, 3u, offsetof(Halton_sampler, m_perm937), 1.0 / 822656953u},
+        {941u, 941u, 3u, offsetof(Halton_sampler, m_perm941), 1.0 / 833237621u},
+        {947u, 947u, 3u, offsetof(Halton_sampler, m_perm947), 1.0 / 849278123u},
+        {953u, 953u, 3u, offsetof(Halton_sampler, m_perm953), 1.0 / 865523177u},
+        {967u, 967u, 3u, offsetof(Halton_sampler, m_perm967), 1.0 / 904231063u},
+        {971u, 971u, 3u, offsetof(Halton_sampler, m_perm971), 1.0 / 915498611u},
+        {977u, 977u, 3u, offsetof(Halton_sampler, m_perm977), 1.0 / 932574833u},
+        {983u, 983u, 3u, offsetof(Halton_sampler, m_perm983), 1.0 / 949862087u},
+        {991u, 991u, 3u, offsetof(Halton_sampler, m_perm991), 1.0 / 973242271u},
+        {997u, 997u, 3u, offsetof(Halton_sampler, m_perm997), 1.0 / 991026973u},
+        {1009u, 1009u, 3u, offsetof(Halton_sampler, m_perm1009), 1.0 / 1027243729u},
+        {1013u, 1013u, 3u, offsetof(Halton_sampler, m_perm1013), 1.0 / 1039509197u},
+        {1019u, 1019u, 3u, offsetof(Halton_sampler, m_perm1019), 1.0 / 1058089859u},
+        {1021u, 1021u, 3u, offsetof(Halton_sampler, m_perm1021), 1.0 / 1064332261u},
+        {1031u, 1031u, 3u, offsetof(Halton_sampler, m_perm1031), 1.0 / 1095912791u},
+        {1033u, 1033u, 3u, offsetof(Halton_sampler, m_perm1033), 1.0 / 1102302937u},
+        {1039u, 1039u, 3u, offsetof(Halton_sampler, m_perm1039), 1.0 / 1121622319u},
+        {1049u, 1049u, 3u, offsetof(Halton_sampler, m_perm1049), 1.0 / 1154320649u},
+        {1051u, 1051u, 3u, offsetof(Halton_sampler, m_perm1051), 1.0 / 1160935651u},
+        {1061u, 1061u, 3u, offsetof(Halton_sampler, m_perm1061), 1.0 / 1194389981u},
+        {1063u, 1063u, 3u, offsetof(Halton_sampler, m_perm1063), 1.0 / 1201157047u},
+        {1069u, 1069u, 3u, offsetof(Halton_sampler, m_perm1069), 1.0 / 1221611509u},
+        {1087u, 1087u, 3u, offsetof(Halton_sampler, m_perm1087), 1.0 / 1284365503u},
+        {1091u, 1091u, 3u, offsetof(Halton_sampler, m_perm1091), 1.0 / 1298596571u},
+        {1093u, 1093u, 3u, offsetof(Halton_sampler, m_perm1093), 1.0 / 1305751357u},
+        {1097u, 1097u, 3u, offsetof(Halton_sampler, m_perm1097), 1.0 / 1320139673u},
+        {1103u, 1103u, 3u, offsetof(Halton_sampler, m_perm1103), 1.0 / 1341919727u},
+        {1109u, 1109u, 3u, offsetof(Halton_sampler, m_perm1109), 1.0 / 1363938029u},
+        {1117u, 1117u, 3u, offsetof(Halton_sampler, m_perm1117), 1.0 / 1393668613u},
+        {1123u, 1123u, 3u, offsetof(Halton_sampler, m_perm1123), 1.0 / 1416247867u},
+        {1129u, 1129u, 3u, offsetof(Halton_sampler, m_perm1129), 1.0 / 1439069689u},
+        {1151u, 1151u, 3u, offsetof(Halton_sampler, m_perm1151), 1.0 / 1524845951u},
+        {1153u, 1153u, 3u, offsetof(Halton_sampler, m_perm1153), 1.0 / 1532808577u},
+        {1163u, 1163u, 3u, offsetof(Halton_sampler, m_perm1163), 1.0 / 1573037747u},
+        {1171u, 1171u, 3u, offsetof(Halton_sampler, m_perm1171), 1.0 / 1605723211u},
+        {1181u, 1181u, 3u, offsetof(Halton_sampler, m_perm1181), 1.0 / 1647212741u},
+        {1187u, 1187u, 3u, offsetof(Halton_sampler, m_perm1187), 1.0 / 1672446203u},
+        {1193u, 1193u, 3u, offsetof(Halton_sampler, m_perm1193), 1.0 / 1697936057u},
+        {1201u, 1201u, 3u, offsetof(Halton_sampler, m_perm1201), 1.0 / 1732323601u},
+        {1213u, 1213u, 3u, offsetof(Halton_sampler, m_perm1213), 1.0 / 1784770597u},
+        {1217u, 1217u, 3u, offsetof(Halton_sampler, m_perm1217), 1.0 / 1802485313u},
+        {1223u, 1223u, 3u, offsetof(Halton_sampler, m_perm1223), 1.0 / 1829276567u},
+        {1229u, 1229u, 3u, offsetof(Halton_sampler, m_perm1229), 1.0 / 1856331989u},
+        {1231u, 1231u, 3u, offsetof(Halton_sampler, m_perm1231), 1.0 / 1865409391u},
+        {1237u, 1237u, 3u, offsetof(Halton_sampler, m_perm1237), 1.0 / 1892819053u},
+        {1249u, 1249u, 3u, offsetof(Halton_sampler, m_perm1249), 1.0 / 1948441249u},
+        {1259u, 1259u, 3u, offsetof(Halton_sampler, m_perm1259), 1.0 / 1995616979u},
+        {1277u, 1277u, 3u, offsetof(Halton_sampler, m_perm1277), 1.0 / 2082440933u},
+        {1279u, 1279u, 3u, offsetof(Halton_sampler, m_perm1279), 1.0 / 2092240639u},
+        {1283u, 1283u, 3u, offsetof(Halton_sampler, m_perm1283), 1.0 / 2111932187u},
+        {1289u, 1289u, 3u, offsetof(Halton_sampler, m_perm1289), 1.0 / 2141700569u},
+        {1291u, 1291u, 3u, offsetof(Halton_sampler, m_perm1291), 1.0 / 2151685171u},
+        {1297u, 1297u, 3u, offsetof(Halton_sampler, m_perm1297), 1.0 / 2181825073u},
+        {1301u, 1301u, 3u, offsetof(Halton_sampler, m_perm1301), 1.0 / 2202073901u},
+        {1303u, 1303u, 3u, offsetof(Halton_sampler, m_perm1303), 1.0 / 2212245127u},
+        {1307u, 1307u, 3u, offsetof(Halton_sampler, m_perm1307), 1.0 / 2232681443u},
+        {1319u, 1319u, 3u, offsetof(Halton_sampler, m_perm1319), 1.0 / 2294744759u},
+        {1321u, 1321u, 3u, offsetof(Halton_sampler, m_perm1321), 1.0 / 2305199161u},
+        {1327u, 1327u, 3u, offsetof(Halton_sampler, m_perm1327), 1.0 / 2336752783u},
+        {1361u, 1361u, 3u, offsetof(Halton_sampler, m_perm1361), 1.0 / 2521008881u},
+        {1367u, 1367u, 3u, offsetof(Halton_sampler, m_perm1367), 1.0 / 2554497863u},
+        {1373u, 1373u, 3u, offsetof(Halton_sampler, m_perm1373), 1.0 / 2588282117u},
+        {1381u, 1381u, 3u, offsetof(Halton_sampler, m_perm1381), 1.0 / 2633789341u},
+        {1399u, 1399u, 3u, offsetof(Halton_sampler, m_perm1399), 1.0 / 2738124199u},
+        {1409u, 1409u, 3u, offsetof(Halton_sampler, m_perm1409), 1.0 / 2797260929u},
+        {1423u, 1423u, 3u, offsetof(Halton_sampler, m_perm1423), 1.0 / 2881473967u},
+        {1427u, 1427u, 3u, offsetof(Halton_sampler, m_perm1427), 1.0 / 2905841483u},
+        {1429u, 1429u, 3u, offsetof(Halton_sampler, m_perm1429), 1.0 / 2918076589u},
+        {1433u, 1433u, 3u, offsetof(Halton_sampler, m_perm1433), 1.0 / 2942649737u},
+        {1439u, 1439u, 3u, offsetof(Halton_sampler, m_perm1439), 1.0 / 2979767519u},
+        {1447u, 1447u, 3u, offsetof(Halton_sampler, m_perm1447), 1.0 / 3029741623u},
+        {1451u, 1451u, 3u, offsetof(Halton_sampler, m_perm1451), 1.0 / 3054936851u},
+        {1453u, 1453u, 3u, offsetof(Halton_sampler, m_perm1453), 1.0 / 3067586677u},
+        {1459u, 1459u, 3u, offsetof(Halton_sampler, m_perm1459), 1.0 / 3105745579u},
+        {1471u, 1471u, 3u, offsetof(Halton_sampler, m_perm1471), 1.0 / 3183010111u},
+        {1481u, 1481u, 3u, offsetof(Halton_sampler, m_perm1481), 1.0 / 3248367641u},
+        {1483u, 1483u, 3u, offsetof(Halton_sampler, m_perm1483), 1.0 / 3261545587u},
+        {1487u, 1487u, 3u, offsetof(Halton_sampler, m_perm1487), 1.0 / 3288008303u},
+        {1489u, 1489u, 3u, offsetof(Halton_sampler, m_perm1489), 1.0 / 3301293169u},
+        {1493u, 1493u, 3u, offsetof(Halton_sampler, m_perm1493), 1.0 / 3327970157u},
+        {1499u, 1499u, 3u, offsetof(Halton_sampler, m_perm1499), 1.0 / 3368254499u},
+        {1511u, 1511u, 3u, offsetof(Halton_sampler, m_perm1511), 1.0 / 3449795831u},
+        {1523u, 1523u, 3u, offsetof(Halton_sampler, m_perm1523), 1.0 / 3532642667u},
+        {1531u, 1531u, 3u, offsetof(Halton_sampler, m_perm1531), 1.0 / 3588604291u},
+        {1543u, 1543u, 3u, offsetof(Halton_sampler, m_perm1543), 1.0 / 3673650007u},
+        {1549u, 1549u, 3u, offsetof(Halton_sampler, m_perm1549), 1.0 / 3716672149u},
+        {1553u, 1553u, 3u, offsetof(Halton_sampler, m_perm1553), 1.0 / 3745539377u},
+        {1559u, 1559u, 3u, offsetof(Halton_sampler, m_perm1559), 1.0 / 3789119879u},
+        {1567u, 1567u, 3u, offsetof(Halton_sampler, m_perm1567), 1.0 / 3847751263u},
+        {1571u, 1571u, 3u, offsetof(Halton_sampler, m_perm1571), 1.0 / 3877292411u},
+        {1579u, 1579u, 3u, offsetof(Halton_sampler, m_perm1579), 1.0 / 3936827539u},
+        {1583u, 1583u, 3u, offsetof(Halton_sampler, m_perm1583), 1.0 / 3966822287u},
+        {1597u, 1597u, 3u, offsetof(Halton_sampler, m_perm1597), 1.0 / 4073003173u},
+        {1601u, 1601u, 3u, offsetof(Halton_sampler, m_perm1601), 1.0 / 4103684801u},
+        {1607u, 1607u, 3u, offsetof(Halton_sampler, m_perm1607), 1.0 / 4149995543u},
+        {1609u, 1609u, 3u, offsetof(Halton_sampler, m_perm1609), 1.0 / 4165509529u},
+        {1613u, 1613u, 3u, offsetof(Halton_sampler, m_perm1613), 1.0 / 4196653397u},
+        {1619u, 1619u, 3u, offsetof(Halton_sampler, m_perm1619), 1.0 / 4243659659u}
+    };
+    return info;
+}
+
 inline unsigned short Halton_sampler::invert(const unsigned short base, const unsigned short digits,
     unsigned short index, const std::vector<unsigned short>& perm)
 {
@@ -3286,17 +3673,80 @@ inline float Halton_sampler::halton1619(const unsigned index) const
             m_perm1619[(index / 2621161u) % 1619u]) * float(0x1.fffffcp-1 / 4243659659u); // Results in [0,1).
 }
 
+// Process-wide cache of initialized samplers, so single-value queries don't
+// rebuild the ~1600 permutations and their tables on every call. Samplers are
+// immutable once built and handed out as shared pointers, so they can be used
+// from several threads and outlive their registry entry. At most
+// MaxCachedRandom randomly seeded samplers are kept; the oldest is dropped
+// first.
+class Halton_sampler_registry
+{
+public:
+    static const size_t MaxCachedRandom = 16;
+
+    static std::shared_ptr<const Halton_sampler> faure()
+    {
+        static const std::shared_ptr<const Halton_sampler> sampler = []() {
+            std::shared_ptr<Halton_sampler> hs = std::make_shared<Halton_sampler>();
+            hs->init_faure();
+            return std::shared_ptr<const Halton_sampler>(hs);
+        }();
+        return sampler;
+    }
+
+    static std::shared_ptr<const Halton_sampler> random(uint32_t seed)
+    {
+        Halton_sampler_registry& registry = instance();
+        {
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            auto it = registry.m_random.find(seed);
+            if (it != registry.m_random.end())
+                return it->second;
+        }
+        // Build outside the lock; if two threads race, both tables are equal.
+        random_gen rng(seed);
+        std::shared_ptr<Halton_sampler> hs = std::make_shared<Halton_sampler>();
+        hs->init_random(rng.rng);
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        auto inserted = registry.m_random.insert(std::make_pair(seed, std::shared_ptr<const Halton_sampler>(hs)));
+        if (inserted.second)
+        {
+            registry.m_order.push_back(seed);
+            if (registry.m_order.size() > MaxCachedRandom)
+            {
+                registry.m_random.erase(registry.m_order.front());
+                registry.m_order.pop_front();
+            }
+        }
+        return inserted.first->second;
+    }
+
+    static void clear()
+    {
+        Halton_sampler_registry& registry = instance();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        registry.m_random.clear();
+        registry.m_order.clear();
+    }
+
+private:
+    static Halton_sampler_registry& instance()
+    {
+        static Halton_sampler_registry registry;
+        return registry;
+    }
+
+    std::mutex m_mutex;
+    std::map<uint32_t, std::shared_ptr<const Halton_sampler> > m_random;
+    std::deque<uint32_t> m_order;
+};
+
 static inline double generate_halton_faure_single(uint64_t  i, unsigned int dim) {
-    Halton_sampler hs;
-    hs.init_faure();
-    return(hs.sample(i,dim));
+    return(Halton_sampler_registry::faure()->sample_f64(dim,i));
 }
 
 static inline double generate_halton_random_single(uint64_t  i, unsigned int dim, unsigned int seed) {
-    random_gen rng(seed);
-    Halton_sampler hs;
-    hs.init_random(rng.rng);
-    return(hs.sample(i,dim));
+    return(Halton_sampler_registry::random(seed)->sample_f64(dim,i));
 }
 
 } //namespace spacefillr
@@ -3,7 +3,9 @@
 
 #include <cstdint>
 #include <cmath>
-#include "Rcpp.h"
+#include <stdexcept>
+
+#include "fast_division.h"
 
 namespace spacefillr {
 
@@ -38,25 +40,43 @@ static const Float OneMinusEpsilon = 0x1.fffffffffffffp-1;
 static const Float OneMinusEpsilon = 0x1.fffffep-1;
 #endif
 
+template <typename T> inline T RadicalInverseOneMinusEpsilon();
+template <> inline float RadicalInverseOneMinusEpsilon<float>() { return 0x1.fffffep-1; }
+template <> inline double RadicalInverseOneMinusEpsilon<double>() { return 0x1.fffffffffffffp-1; }
+
 // Low Discrepancy Static Functions
-template <int base>
-static Float RadicalInverseSpecialized(std::uint64_t a) {
-  const Float invBase = (Float)1 / (Float)base;
+// Digits come from precomputed dividers. While the rest of the index is 64-bit
+// the full 64-bit divider is needed; after that (from the start for indices
+// below 2^32) the cheaper 32-bit one takes over.
+template <int base, typename T = Float>
+static T RadicalInverseSpecialized(std::uint64_t a) {
+  constexpr fast_divider_u64 divider64(base);
+  constexpr fast_divider_u32 divider32(base);
+  const T invBase = (T)1 / (T)base;
   std::uint64_t reversedDigits = 0;
-  Float invBaseN = 1;
-  while (a) {
-    std::uint64_t next = a / base;
+  T invBaseN = 1;
+  while (a > 0xffffffffu) {
+    std::uint64_t next = divider64.quotient(a);
     std::uint64_t digit = a - next * base;
     reversedDigits = reversedDigits * base + digit;
     invBaseN *= invBase;
     a = next;
   }
-  return std::fmin(reversedDigits * invBaseN, OneMinusEpsilon);
+  std::uint32_t rest = (std::uint32_t)a;
+  while (rest) {
+    std::uint32_t next = divider32.quotient(rest);
+    std::uint32_t digit = rest - next * base;
+    reversedDigits = reversedDigits * base + digit;
+    invBaseN *= invBase;
+    rest = next;
+  }
+  return std::fmin(reversedDigits * invBaseN, RadicalInverseOneMinusEpsilon<T>());
 }
 
 
 // Low Discrepancy Function Definitions
-Float RadicalInverse(int baseIndex, std::uint64_t a) {
+template <typename T>
+T RadicalInverseT(int baseIndex, std::uint64_t a) {
   switch (baseIndex) {
   case 0:
     // Compute base-2 radical inverse
@@ -66,2056 +86,2068 @@ Float RadicalInverse(int baseIndex, std::uint64_t a) {
     return ReverseBits64(a) * 0x1p-64;
 #endif
   case 1:
-    return RadicalInverseSpecialized<3>(a);
+    return RadicalInverseSpecialized<3, T>(a);
   case 2:
-    return RadicalInverseSpecialized<5>(a);
+    return RadicalInverseSpecialized<5, T>(a);
   case 3:
-    return RadicalInverseSpecialized<7>(a);
+    return RadicalInverseSpecialized<7, T>(a);
     // Remainder of cases for _RadicalInverse()_
   case 4:
-    return RadicalInverseSpecialized<11>(a);
+    return RadicalInverseSpecialized<11, T>(a);
   case 5:
-    return RadicalInverseSpecialized<13>(a);
+    return RadicalInverseSpecialized<13, T>(a);
   case 6:
-    return RadicalInverseSpecialized<17>(a);
+    return RadicalInverseSpecialized<17, T>(a);
   case 7:
-    return RadicalInverseSpecialized<19>(a);
+    return RadicalInverseSpecialized<19, T>(a);
   case 8:
-    return RadicalInverseSpecialized<23>(a);
+    return RadicalInverseSpecialized<23, T>(a);
   case 9:
-    return RadicalInverseSpecialized<29>(a);
+    return RadicalInverseSpecialized<29, T>(a);
   case 10:
-    return RadicalInverseSpecialized<31>(a);
+    return RadicalInverseSpecialized<31, T>(a);
   case 11:
-    return RadicalInverseSpecialized<37>(a);
+    return RadicalInverseSpecialized<37, T>(a);
   case 12:
-    return RadicalInverseSpecialized<41>(a);
+    return RadicalInverseSpecialized<41, T>(a);
   case 13:
-    return RadicalInverseSpecialized<43>(a);
+    return RadicalInverseSpecialized<43, T>(a);
   case 14:
-    return RadicalInverseSpecialized<47>(a);
+    return RadicalInverseSpecialized<47, T>(a);
   case 15:
-    return RadicalInverseSpecialized<53>(a);
+    return RadicalInverseSpecialized<53, T>(a);
   case 16:
-    return RadicalInverseSpecialized<59>(a);
+    return RadicalInverseSpecialized<59, T>(a);
   case 17:
-    return RadicalInverseSpecialized<61>(a);
+    return RadicalInverseSpecialized<61, T>(a);
   case 18:
-    return RadicalInverseSpecialized<67>(a);
+    return RadicalInverseSpecialized<67, T>(a);
   case 19:
-    return RadicalInverseSpecialized<71>(a);
+    return RadicalInverseSpecialized<71, T>(a);
   case 20:
-    return RadicalInverseSpecialized<73>(a);
+    return RadicalInverseSpecialized<73, T>(a);
   case 21:
-    return RadicalInverseSpecialized<79>(a);
+    return RadicalInverseSpecialized<79, T>(a);
   case 22:
-    return RadicalInverseSpecialized<83>(a);
+    return RadicalInverseSpecialized<83, T>(a);
   case 23:
-    return RadicalInverseSpecialized<89>(a);
+    return RadicalInverseSpecialized<89, T>(a);
   case 24:
-    return RadicalInverseSpecialized<97>(a);
+    return RadicalInverseSpecialized<97, T>(a);
   case 25:
-    return RadicalInverseSpecialized<101>(a);
+    return RadicalInverseSpecialized<101, T>(a);
   case 26:
-    return RadicalInverseSpecialized<103>(a);
+    return RadicalInverseSpecialized<103, T>(a);
   case 27:
-    return RadicalInverseSpecialized<107>(a);
+    return RadicalInverseSpecialized<107, T>(a);
   case 28:
-    return RadicalInverseSpecialized<109>(a);
+    return RadicalInverseSpecialized<109, T>(a);
   case 29:
-    return RadicalInverseSpecialized<113>(a);
+    return RadicalInverseSpecialized<113, T>(a);
   case 30:
-    return RadicalInverseSpecialized<127>(a);
+    return RadicalInverseSpecialized<127, T>(a);
   case 31:
-    return RadicalInverseSpecialized<131>(a);
+    return RadicalInverseSpecialized<131, T>(a);
   case 32:
-    return RadicalInverseSpecialized<137>(a);
+    return RadicalInverseSpecialized<137, T>(a);
   case 33:
-    return RadicalInverseSpecialized<139>(a);
+    return RadicalInverseSpecialized<139, T>(a);
   case 34:
-    return RadicalInverseSpecialized<149>(a);
+    return RadicalInverseSpecialized<149, T>(a);
   case 35:
-    return RadicalInverseSpecialized<151>(a);
+    return RadicalInverseSpecialized<151, T>(a);
   case 36:
-    return RadicalInverseSpecialized<157>(a);
+    return RadicalInverseSpecialized<157, T>(a);
   case 37:
-    return RadicalInverseSpecialized<163>(a);
+    return RadicalInverseSpecialized<163, T>(a);
   case 38:
-    return RadicalInverseSpecialized<167>(a);
+    return RadicalInverseSpecialized<167, T>(a);
   case 39:
-    return RadicalInverseSpecialized<173>(a);
+    return RadicalInverseSpecialized<173, T>(a);
   case 40:
-    return RadicalInverseSpecialized<179>(a);
+    return RadicalInverseSpecialized<179, T>(a);
   case 41:
-    return RadicalInverseSpecialized<181>(a);
+    return RadicalInverseSpecialized<181, T>(a);
   case 42:
-    return RadicalInverseSpecialized<191>(a);
+    return RadicalInverseSpecialized<191, T>(a);
   case 43:
-    return RadicalInverseSpecialized<193>(a);
+    return RadicalInverseSpecialized<193, T>(a);
   case 44:
-    return RadicalInverseSpecialized<197>(a);
+    return RadicalInverseSpecialized<197, T>(a);
   case 45:
-    return RadicalInverseSpecialized<199>(a);
+    return RadicalInverseSpecialized<199, T>(a);
   case 46:
-    return RadicalInverseSpecialized<211>(a);
+    return RadicalInverseSpecialized<211, T>(a);
   case 47:
-    return RadicalInverseSpecialized<223>(a);
+    return RadicalInverseSpecialized<223, T>(a);
   case 48:
-    return RadicalInverseSpecialized<227>(a);
+    return RadicalInverseSpecialized<227, T>(a);
   case 49:
-    return RadicalInverseSpecialized<229>(a);
+    return RadicalInverseSpecialized<229, T>(a);
   case 50:
-    return RadicalInverseSpecialized<233>(a);
+    return RadicalInverseSpecialized<233, T>(a);
   case 51:
-    return RadicalInverseSpecialized<239>(a);
+    return RadicalInverseSpecialized<239, T>(a);
   case 52:
-    return RadicalInverseSpecialized<241>(a);
+    return RadicalInverseSpecialized<241, T>(a);
   case 53:
-    return RadicalInverseSpecialized<251>(a);
+    return RadicalInverseSpecialized<251, T>(a);
   case 54:
-    return RadicalInverseSpecialized<257>(a);
+    return RadicalInverseSpecialized<257, T>(a);
   case 55:
-    return RadicalInverseSpecialized<263>(a);
+    return RadicalInverseSpecialized<263, T>(a);
   case 56:
-    return RadicalInverseSpecialized<269>(a);
+    return RadicalInverseSpecialized<269, T>(a);
   case 57:
-    return RadicalInverseSpecialized<271>(a);
+    return RadicalInverseSpecialized<271, T>(a);
   case 58:
-    return RadicalInverseSpecialized<277>(a);
+    return RadicalInverseSpecialized<277, T>(a);
   case 59:
-    return RadicalInverseSpecialized<281>(a);
+    return RadicalInverseSpecialized<281, T>(a);
   case 60:
-    return RadicalInverseSpecialized<283>(a);
+    return RadicalInverseSpecialized<283, T>(a);
   case 61:
-    return RadicalInverseSpecialized<293>(a);
+    return RadicalInverseSpecialized<293, T>(a);
   case 62:
-    return RadicalInverseSpecialized<307>(a);
+    return RadicalInverseSpecialized<307, T>(a);
   case 63:
-    return RadicalInverseSpecialized<311>(a);
+    return RadicalInverseSpecialized<311, T>(a);
   case 64:
-    return RadicalInverseSpecialized<313>(a);
+    return RadicalInverseSpecialized<313, T>(a);
   case 65:
-    return RadicalInverseSpecialized<317>(a);
+    return RadicalInverseSpecialized<317, T>(a);
   case 66:
-    return RadicalInverseSpecialized<331>(a);
+    return RadicalInverseSpecialized<331, T>(a);
   case 67:
-    return RadicalInverseSpecialized<337>(a);
+    return RadicalInverseSpecialized<337, T>(a);
   case 68:
-    return RadicalInverseSpecialized<347>(a);
+    return RadicalInverseSpecialized<347, T>(a);
   case 69:
-    return RadicalInverseSpecialized<349>(a);
+    return RadicalInverseSpecialized<349, T>(a);
   case 70:
-    return RadicalInverseSpecialized<353>(a);
+    return RadicalInverseSpecialized<353, T>(a);
   case 71:
-    return RadicalInverseSpecialized<359>(a);
+    return RadicalInverseSpecialized<359, T>(a);
   case 72:
-    return RadicalInverseSpecialized<367>(a);
+    return RadicalInverseSpecialized<367, T>(a);
   case 73:
-    return RadicalInverseSpecialized<373>(a);
+    return RadicalInverseSpecialized<373, T>(a);
   case 74:
-    return RadicalInverseSpecialized<379>(a);
+    return RadicalInverseSpecialized<379, T>(a);
   case 75:
-    return RadicalInverseSpecialized<383>(a);
+    return RadicalInverseSpecialized<383, T>(a);
   case 76:
-    return RadicalInverseSpecialized<389>(a);
+    return RadicalInverseSpecialized<389, T>(a);
   case 77:
-    return RadicalInverseSpecialized<397>(a);
+    return RadicalInverseSpecialized<397, T>(a);
   case 78:
-    return RadicalInverseSpecialized<401>(a);
+    return RadicalInverseSpecialized<401, T>(a);
   case 79:
-    return RadicalInverseSpecialized<409>(a);
+    return RadicalInverseSpecialized<409, T>(a);
   case 80:
-    return RadicalInverseSpecialized<419>(a);
+    return RadicalInverseSpecialized<419, T>(a);
   case 81:
-    return RadicalInverseSpecialized<421>(a);
+    return RadicalInverseSpecialized<421, T>(a);
   case 82:
-    return RadicalInverseSpecialized<431>(a);
+    return RadicalInverseSpecialized<431, T>(a);
   case 83:
-    return RadicalInverseSpecialized<433>(a);
+    return RadicalInverseSpecialized<433, T>(a);
   case 84:
-    return RadicalInverseSpecialized<439>(a);
+    return RadicalInverseSpecialized<439, T>(a);
   case 85:
-    return RadicalInverseSpecialized<443>(a);
+    return RadicalInverseSpecialized<443, T>(a);
   case 86:
-    return RadicalInverseSpecialized<449>(a);
+    return RadicalInverseSpecialized<449, T>(a);
   case 87:
-    return RadicalInverseSpecialized<457>(a);
+    return RadicalInverseSpecialized<457, T>(a);
   case 88:
-    return RadicalInverseSpecialized<461>(a);
+    return RadicalInverseSpecialized<461, T>(a);
   case 89:
-    return RadicalInverseSpecialized<463>(a);
+    return RadicalInverseSpecialized<463, T>(a);
   case 90:
-    return RadicalInverseSpecialized<467>(a);
+    return RadicalInverseSpecialized<467, T>(a);
   case 91:
-    return RadicalInverseSpecialized<479>(a);
+    return RadicalInverseSpecialized<479, T>(a);
   case 92:
-    return RadicalInverseSpecialized<487>(a);
+    return RadicalInverseSpecialized<487, T>(a);
   case 93:
-    return RadicalInverseSpecialized<491>(a);
+    return RadicalInverseSpecialized<491, T>(a);
   case 94:
-    return RadicalInverseSpecialized<499>(a);
+    return RadicalInverseSpecialized<499, T>(a);
   case 95:
-    return RadicalInverseSpecialized<503>(a);
+    return RadicalInverseSpecialized<503, T>(a);
   case 96:
-    return RadicalInverseSpecialized<509>(a);
+    return RadicalInverseSpecialized<509, T>(a);
   case 97:
-    return RadicalInverseSpecialized<521>(a);
+    return RadicalInverseSpecialized<521, T>(a);
   case 98:
-    return RadicalInverseSpecialized<523>(a);
+    return RadicalInverseSpecialized<523, T>(a);
   case 99:
-    return RadicalInverseSpecialized<541>(a);
+    return RadicalInverseSpecialized<541, T>(a);
   case 100:
-    return RadicalInverseSpecialized<547>(a);
+    return RadicalInverseSpecialized<547, T>(a);
   case 101:
-    return RadicalInverseSpecialized<557>(a);
+    return RadicalInverseSpecialized<557, T>(a);
   case 102:
-    return RadicalInverseSpecialized<563>(a);
+    return RadicalInverseSpecialized<563, T>(a);
   case 103:
-    return RadicalInverseSpecialized<569>(a);
+    return RadicalInverseSpecialized<569, T>(a);
   case 104:
-    return RadicalInverseSpecialized<571>(a);
+    return RadicalInverseSpecialized<571, T>(a);
   case 105:
-    return RadicalInverseSpecialized<577>(a);
+    return RadicalInverseSpecialized<577, T>(a);
   case 106:
-    return RadicalInverseSpecialized<587>(a);
+    return RadicalInverseSpecialized<587, T>(a);
   case 107:
-    return RadicalInverseSpecialized<593>(a);
+    return RadicalInverseSpecialized<593, T>(a);
   case 108:
-    return RadicalInverseSpecialized<599>(a);
+    return RadicalInverseSpecialized<599, T>(a);
   case 109:
-    return RadicalInverseSpecialized<601>(a);
+    return RadicalInverseSpecialized<601, T>(a);
   case 110:
-    return RadicalInverseSpecialized<607>(a);
+    return RadicalInverseSpecialized<607, T>(a);
   case 111:
-    return RadicalInverseSpecialized<613>(a);
+    return RadicalInverseSpecialized<613, T>(a);
   case 112:
-    return RadicalInverseSpecialized<617>(a);
+    return RadicalInverseSpecialized<617, T>(a);
   case 113:
-    return RadicalInverseSpecialized<619>(a);
+    return RadicalInverseSpecialized<619, T>(a);
   case 114:
-    return RadicalInverseSpecialized<631>(a);
+    return RadicalInverseSpecialized<631, T>(a);
   case 115:
-    return RadicalInverseSpecialized<641>(a);
+    return RadicalInverseSpecialized<641, T>(a);
   case 116:
-    return RadicalInverseSpecialized<643>(a);
+    return RadicalInverseSpecialized<643, T>(a);
   case 117:
-    return RadicalInverseSpecialized<647>(a);
+    return RadicalInverseSpecialized<647, T>(a);
   case 118:
-    return RadicalInverseSpecialized<653>(a);
+    return RadicalInverseSpecialized<653, T>(a);
   case 119:
-    return RadicalInverseSpecialized<659>(a);
+    return RadicalInverseSpecialized<659, T>(a);
   case 120:
-    return RadicalInverseSpecialized<661>(a);
+    return RadicalInverseSpecialized<661, T>(a);
   case 121:
-    return RadicalInverseSpecialized<673>(a);
+    return RadicalInverseSpecialized<673, T>(a);
   case 122:
-    return RadicalInverseSpecialized<677>(a);
+    return RadicalInverseSpecialized<677, T>(a);
   case 123:
-    return RadicalInverseSpecialized<683>(a);
+    return RadicalInverseSpecialized<683, T>(a);
   case 124:
-    return RadicalInverseSpecialized<691>(a);
+    return RadicalInverseSpecialized<691, T>(a);
   case 125:
-    return RadicalInverseSpecialized<701>(a);
+    return RadicalInverseSpecialized<701, T>(a);
   case 126:
-    return RadicalInverseSpecialized<709>(a);
+    return RadicalInverseSpecialized<709, T>(a);
   case 127:
-    return RadicalInverseSpecialized<719>(a);
+    return RadicalInverseSpecialized<719, T>(a);
   case 128:
-    return RadicalInverseSpecialized<727>(a);
+    return RadicalInverseSpecialized<727, T>(a);
   case 129:
-    return RadicalInverseSpecialized<733>(a);
+    return RadicalInverseSpecialized<733, T>(a);
   case 130:
-    return RadicalInverseSpecialized<739>(a);
+    return RadicalInverseSpecialized<739, T>(a);
   case 131:
-    return RadicalInverseSpecialized<743>(a);
+    return RadicalInverseSpecialized<743, T>(a);
   case 132:
-    return RadicalInverseSpecialized<751>(a);
+    return RadicalInverseSpecialized<751, T>(a);
   case 133:
-    return RadicalInverseSpecialized<757>(a);
+    return RadicalInverseSpecialized<757, T>(a);
   case 134:
-    return RadicalInverseSpecialized<761>(a);
+    return RadicalInverseSpecialized<761, T>(a);
   case 135:
-    return RadicalInverseSpecialized<769>(a);
+    return RadicalInverseSpecialized<769, T>(a);
   case 136:
-    return RadicalInverseSpecialized<773>(a);
+    return RadicalInverseSpecialized<773, T>(a);
   case 137:
-    return RadicalInverseSpecialized<787>(a);
+    return RadicalInverseSpecialized<787, T>(a);
   case 138:
-    return RadicalInverseSpecialized<797>(a);
+    return RadicalInverseSpecialized<797, T>(a);
   case 139:
-    return RadicalInverseSpecialized<809>(a);
+    return RadicalInverseSpecialized<809, T>(a);
   case 140:
-    return RadicalInverseSpecialized<811>(a);
+    return RadicalInverseSpecialized<811, T>(a);
   case 141:
-    return RadicalInverseSpecialized<821>(a);
+    return RadicalInverseSpecialized<821, T>(a);
   case 142:
-    return RadicalInverseSpecialized<823>(a);
+    return RadicalInverseSpecialized<823, T>(a);
   case 143:
-    return RadicalInverseSpecialized<827>(a);
+    return RadicalInverseSpecialized<827, T>(a);
   case 144:
-    return RadicalInverseSpecialized<829>(a);
+    return RadicalInverseSpecialized<829, T>(a);
   case 145:
-    return RadicalInverseSpecialized<839>(a);
+    return RadicalInverseSpecialized<839, T>(a);
   case 146:
-    return RadicalInverseSpecialized<853>(a);
+    return RadicalInverseSpecialized<853, T>(a);
   case 147:
-    return RadicalInverseSpecialized<857>(a);
+    return RadicalInverseSpecialized<857, T>(a);
   case 148:
-    return RadicalInverseSpecialized<859>(a);
+    return RadicalInverseSpecialized<859, T>(a);
   case 149:
-    return RadicalInverseSpecialized<863>(a);
+    return RadicalInverseSpecialized<863, T>(a);
   case 150:
-    return RadicalInverseSpecialized<877>(a);
+    return RadicalInverseSpecialized<877, T>(a);
   case 151:
-    return RadicalInverseSpecialized<881>(a);
+    return RadicalInverseSpecialized<881, T>(a);
   case 152:
-    return RadicalInverseSpecialized<883>(a);
+    return RadicalInverseSpecialized<883, T>(a);
   case 153:
-    return RadicalInverseSpecialized<887>(a);
+    return RadicalInverseSpecialized<887, T>(a);
   case 154:
-    return RadicalInverseSpecialized<907>(a);
+    return RadicalInverseSpecialized<907, T>(a);
   case 155:
-    return RadicalInverseSpecialized<911>(a);
+    return RadicalInverseSpecialized<911, T>(a);
   case 156:
-    return RadicalInverseSpecialized<919>(a);
+    return RadicalInverseSpecialized<919, T>(a);
   case 157:
-    return RadicalInverseSpecialized<929>(a);
+    return RadicalInverseSpecialized<929, T>(a);
   case 158:
-    return RadicalInverseSpecialized<937>(a);
+    return RadicalInverseSpecialized<937, T>(a);
   case 159:
-    return RadicalInverseSpecialized<941>(a);
+    return RadicalInverseSpecialized<941, T>(a);
   case 160:
-    return RadicalInverseSpecialized<947>(a);
+    return RadicalInverseSpecialized<947, T>(a);
   case 161:
-    return RadicalInverseSpecialized<953>(a);
+    return RadicalInverseSpecialized<953, T>(a);
   case 162:
-    return RadicalInverseSpecialized<967>(a);
+    return RadicalInverseSpecialized<967, T>(a);
   case 163:
-    return RadicalInverseSpecialized<971>(a);
+    return RadicalInverseSpecialized<971, T>(a);
   case 164:
-    return RadicalInverseSpecialized<977>(a);
+    return RadicalInverseSpecialized<977, T>(a);
   case 165:
-    return RadicalInverseSpecialized<983>(a);
+    return RadicalInverseSpecialized<983, T>(a);
   case 166:
-    return RadicalInverseSpecialized<991>(a);
+    return RadicalInverseSpecialized<991, T>(a);
   case 167:
-    return RadicalInverseSpecialized<997>(a);
+    return RadicalInverseSpecialized<997, T>(a);
   case 168:
-    return RadicalInverseSpecialized<1009>(a);
+    return RadicalInverseSpecialized<1009, T>(a);
   case 169:
-    return RadicalInverseSpecialized<1013>(a);
+    return RadicalInverseSpecialized<1013, T>(a);
   case 170:
-    return RadicalInverseSpecialized<1019>(a);
+    return RadicalInverseSpecialized<1019, T>(a);
   case 171:
-    return RadicalInverseSpecialized<1021>(a);
+    return RadicalInverseSpecialized<1021, T>(a);
   case 172:
-    return RadicalInverseSpecialized<1031>(a);
+    return RadicalInverseSpecialized<1031, T>(a);
   case 173:
-    return RadicalInverseSpecialized<1033>(a);
+    return RadicalInverseSpecialized<1033, T>(a);
   case 174:
-    return RadicalInverseSpecialized<1039>(a);
+    return RadicalInverseSpecialized<1039, T>(a);
   case 175:
-    return RadicalInverseSpecialized<1049>(a);
+    return RadicalInverseSpecialized<1049, T>(a);
   case 176:
-    return RadicalInverseSpecialized<1051>(a);
+    return RadicalInverseSpecialized<1051, T>(a);
   case 177:
-    return RadicalInverseSpecialized<1061>(a);
+    return RadicalInverseSpecialized<1061, T>(a);
   case 178:
-    return RadicalInverseSpecialized<1063>(a);
+    return RadicalInverseSpecialized<1063, T>(a);
   case 179:
-    return RadicalInverseSpecialized<1069>(a);
+    return RadicalInverseSpecialized<1069, T>(a);
   case 180:
-    return RadicalInverseSpecialized<1087>(a);
+    return RadicalInverseSpecialized<1087, T>(a);
   case 181:
-    return RadicalInverseSpecialized<1091>(a);
+    return RadicalInverseSpecialized<1091, T>(a);
   case 182:
-    return RadicalInverseSpecialized<1093>(a);
+    return RadicalInverseSpecialized<1093, T>(a);
   case 183:
-    return RadicalInverseSpecialized<1097>(a);
+    return RadicalInverseSpecialized<1097, T>(a);
   case 184:
-    return RadicalInverseSpecialized<1103>(a);
+    return RadicalInverseSpecialized<1103, T>(a);
   case 185:
-    return RadicalInverseSpecialized<1109>(a);
+    return RadicalInverseSpecialized<1109, T>(a);
   case 186:
-    return RadicalInverseSpecialized<1117>(a);
+    return RadicalInverseSpecialized<1117, T>(a);
   case 187:
-    return RadicalInverseSpecialized<1123>(a);
+    return RadicalInverseSpecialized<1123, T>(a);
   case 188:
-    return RadicalInverseSpecialized<1129>(a);
+    return RadicalInverseSpecialized<1129, T>(a);
   case 189:
-    return RadicalInverseSpecialized<1151>(a);
+    return RadicalInverseSpecialized<1151, T>(a);
   case 190:
-    return RadicalInverseSpecialized<1153>(a);
+    return RadicalInverseSpecialized<1153, T>(a);
   case 191:
-    return RadicalInverseSpecialized<1163>(a);
+    return RadicalInverseSpecialized<1163, T>(a);
   case 192:
-    return RadicalInverseSpecialized<1171>(a);
+    return RadicalInverseSpecialized<1171, T>(a);
   case 193:
-    return RadicalInverseSpecialized<1181>(a);
+    return RadicalInverseSpecialized<1181, T>(a);
   case 194:
-    return RadicalInverseSpecialized<1187>(a);
+    return RadicalInverseSpecialized<1187, T>(a);
   case 195:
-    return RadicalInverseSpecialized<1193>(a);
+    return RadicalInverseSpecialized<1193, T>(a);
   case 196:
-    return RadicalInverseSpecialized<1201>(a);
+    return RadicalInverseSpecialized<1201, T>(a);
   case 197:
-    return RadicalInverseSpecialized<1213>(a);
+    return RadicalInverseSpecialized<1213, T>(a);
   case 198:
-    return RadicalInverseSpecialized<1217>(a);
+    return RadicalInverseSpecialized<1217, T>(a);
   case 199:
-    return RadicalInverseSpecialized<1223>(a);
+    return RadicalInverseSpecialized<1223, T>(a);
   case 200:
-    return RadicalInverseSpecialized<1229>(a);
+    return RadicalInverseSpecialized<1229, T>(a);
   case 201:
-    return RadicalInverseSpecialized<1231>(a);
+    return RadicalInverseSpecialized<1231, T>(a);
   case 202:
-    return RadicalInverseSpecialized<1237>(a);
+    return RadicalInverseSpecialized<1237, T>(a);
   case 203:
-    return RadicalInverseSpecialized<1249>(a);
+    return RadicalInverseSpecialized<1249, T>(a);
   case 204:
-    return RadicalInverseSpecialized<1259>(a);
+    return RadicalInverseSpecialized<1259, T>(a);
   case 205:
-    return RadicalInverseSpecialized<1277>(a);
+    return RadicalInverseSpecialized<1277, T>(a);
   case 206:
-    return RadicalInverseSpecialized<1279>(a);
+    return RadicalInverseSpecialized<1279, T>(a);
   case 207:
-    return RadicalInverseSpecialized<1283>(a);
+    return RadicalInverseSpecialized<1283, T>(a);
   case 208:
-    return RadicalInverseSpecialized<1289>(a);
+    return RadicalInverseSpecialized<1289, T>(a);
   case 209:
-    return RadicalInverseSpecialized<1291>(a);
+    return RadicalInverseSpecialized<1291, T>(a);
   case 210:
-    return RadicalInverseSpecialized<1297>(a);
+    return RadicalInverseSpecialized<1297, T>(a);
   case 211:
-    return RadicalInverseSpecialized<1301>(a);
+    return RadicalInverseSpecialized<1301, T>(a);
   case 212:
-    return RadicalInverseSpecialized<1303>(a);
+    return RadicalInverseSpecialized<1303, T>(a);
   case 213:
-    return RadicalInverseSpecialized<1307>(a);
+    return RadicalInverseSpecialized<1307, T>(a);
   case 214:
-    return RadicalInverseSpecialized<1319>(a);
+    return RadicalInverseSpecialized<1319, T>(a);
   case 215:
-    return RadicalInverseSpecialized<1321>(a);
+    return RadicalInverseSpecialized<1321, T>(a);
   case 216:
-    return RadicalInverseSpecialized<1327>(a);
+    return RadicalInverseSpecialized<1327, T>(a);
   case 217:
-    return RadicalInverseSpecialized<1361>(a);
+    return RadicalInverseSpecialized<1361, T>(a);
   case 218:
-    return RadicalInverseSpecialized<1367>(a);
+    return RadicalInverseSpecialized<1367, T>(a);
   case 219:
-    return RadicalInverseSpecialized<1373>(a);
+    return RadicalInverseSpecialized<1373, T>(a);
   case 220:
-    return RadicalInverseSpecialized<1381>(a);
+    return RadicalInverseSpecialized<1381, T>(a);
   case 221:
-    return RadicalInverseSpecialized<1399>(a);
+    return RadicalInverseSpecialized<1399, T>(a);
   case 222:
-    return RadicalInverseSpecialized<1409>(a);
+    return RadicalInverseSpecialized<1409, T>(a);
   case 223:
-    return RadicalInverseSpecialized<1423>(a);
+    return RadicalInverseSpecialized<1423, T>(a);
   case 224:
-    return RadicalInverseSpecialized<1427>(a);
+    return RadicalInverseSpecialized<1427, T>(a);
   case 225:
-    return RadicalInverseSpecialized<1429>(a);
+    return RadicalInverseSpecialized<1429, T>(a);
   case 226:
-    return RadicalInverseSpecialized<1433>(a);
+    return RadicalInverseSpecialized<1433, T>(a);
   case 227:
-    return RadicalInverseSpecialized<1439>(a);
+    return RadicalInverseSpecialized<1439, T>(a);
   case 228:
-    return RadicalInverseSpecialized<1447>(a);
+    return RadicalInverseSpecialized<1447, T>(a);
   case 229:
-    return RadicalInverseSpecialized<1451>(a);
+    return RadicalInverseSpecialized<1451, T>(a);
   case 230:
-    return RadicalInverseSpecialized<1453>(a);
+    return RadicalInverseSpecialized<1453, T>(a);
   case 231:
-    return RadicalInverseSpecialized<1459>(a);
+    return RadicalInverseSpecialized<1459, T>(a);
   case 232:
-    return RadicalInverseSpecialized<1471>(a);
+    return RadicalInverseSpecialized<1471, T>(a);
   case 233:
-    return RadicalInverseSpecialized<1481>(a);
+    return RadicalInverseSpecialized<1481, T>(a);
   case 234:
-    return RadicalInverseSpecialized<1483>(a);
+    return RadicalInverseSpecialized<1483, T>(a);
   case 235:
-    return RadicalInverseSpecialized<1487>(a);
+    return RadicalInverseSpecialized<1487, T>(a);
   case 236:
-    return RadicalInverseSpecialized<1489>(a);
+    return RadicalInverseSpecialized<1489, T>(a);
   case 237:
-    return RadicalInverseSpecialized<1493>(a);
+    return RadicalInverseSpecialized<1493, T>(a);
   case 238:
-    return RadicalInverseSpecialized<1499>(a);
+    return RadicalInverseSpecialized<1499, T>(a);
   case 239:
-    return RadicalInverseSpecialized<1511>(a);
+    return RadicalInverseSpecialized<1511, T>(a);
   case 240:
-    return RadicalInverseSpecialized<1523>(a);
+    return RadicalInverseSpecialized<1523, T>(a);
   case 241:
-    return RadicalInverseSpecialized<1531>(a);
+    return RadicalInverseSpecialized<1531, T>(a);
   case 242:
-    return RadicalInverseSpecialized<1543>(a);
+    return RadicalInverseSpecialized<1543, T>(a);
   case 243:
-    return RadicalInverseSpecialized<1549>(a);
+    return RadicalInverseSpecialized<1549, T>(a);
   case 244:
-    return RadicalInverseSpecialized<1553>(a);
+    return RadicalInverseSpecialized<1553, T>(a);
   case 245:
-    return RadicalInverseSpecialized<1559>(a);
+    return RadicalInverseSpecialized<1559, T>(a);
   case 246:
-    return RadicalInverseSpecialized<1567>(a);
+    return RadicalInverseSpecialized<1567, T>(a);
   case 247:
-    return RadicalInverseSpecialized<1571>(a);
+    return RadicalInverseSpecialized<1571, T>(a);
   case 248:
-    return RadicalInverseSpecialized<1579>(a);
+    return RadicalInverseSpecialized<1579, T>(a);
   case 249:
-    return RadicalInverseSpecialized<1583>(a);
+    return RadicalInverseSpecialized<1583, T>(a);
   case 250:
-    return RadicalInverseSpecialized<1597>(a);
+    return RadicalInverseSpecialized<1597, T>(a);
   case 251:
-    return RadicalInverseSpecialized<1601>(a);
+    return RadicalInverseSpecialized<1601, T>(a);
   case 252:
-    return RadicalInverseSpecialized<1607>(a);
+    return RadicalInverseSpecialized<1607, T>(a);
   case 253:
-    return RadicalInverseSpecialized<1609>(a);
+    return RadicalInverseSpecialized<1609, T>(a);
   case 254:
-    return RadicalInverseSpecialized<1613>(a);
+    return RadicalInverseSpecialized<1613, T>(a);
   case 255:
-    return RadicalInverseSpecialized<1619>(a);
+    return RadicalInverseSpecialized<1619, T>(a);
   case 256:
-    return RadicalInverseSpecialized<1621>(a);
+    return RadicalInverseSpecialized<1621, T>(a);
   case 257:
-    return RadicalInverseSpecialized<1627>(a);
+    return RadicalInverseSpecialized<1627, T>(a);
   case 258:
-    return RadicalInverseSpecialized<1637>(a);
+    return RadicalInverseSpecialized<1637, T>(a);
   case 259:
-    return RadicalInverseSpecialized<1657>(a);
+    return RadicalInverseSpecialized<1657, T>(a);
   case 260:
-    return RadicalInverseSpecialized<1663>(a);
+    return RadicalInverseSpecialized<1663, T>(a);
   case 261:
-    return RadicalInverseSpecialized<1667>(a);
+    return RadicalInverseSpecialized<1667, T>(a);
   case 262:
-    return RadicalInverseSpecialized<1669>(a);
+    return RadicalInverseSpecialized<1669, T>(a);
   case 263:
-    return RadicalInverseSpecialized<1693>(a);
+    return RadicalInverseSpecialized<1693, T>(a);
   case 264:
-    return RadicalInverseSpecialized<1697>(a);
+    return RadicalInverseSpecialized<1697, T>(a);
   case 265:
-    return RadicalInverseSpecialized<1699>(a);
+    return RadicalInverseSpecialized<1699, T>(a);
   case 266:
-    return RadicalInverseSpecialized<1709>(a);
+    return RadicalInverseSpecialized<1709, T>(a);
   case 267:
-    return RadicalInverseSpecialized<1721>(a);
+    return RadicalInverseSpecialized<1721, T>(a);
   case 268:
-    return RadicalInverseSpecialized<1723>(a);
+    return RadicalInverseSpecialized<1723, T>(a);
   case 269:
-    return RadicalInverseSpecialized<1733>(a);
+    return RadicalInverseSpecialized<1733, T>(a);
   case 270:
-    return RadicalInverseSpecialized<1741>(a);
+    return RadicalInverseSpecialized<1741, T>(a);
   case 271:
-    return RadicalInverseSpecialized<1747>(a);
+    return RadicalInverseSpecialized<1747, T>(a);
   case 272:
-    return RadicalInverseSpecialized<1753>(a);
+    return RadicalInverseSpecialized<1753, T>(a);
   case 273:
-    return RadicalInverseSpecialized<1759>(a);
+    return RadicalInverseSpecialized<1759, T>(a);
   case 274:
-    return RadicalInverseSpecialized<1777>(a);
+    return RadicalInverseSpecialized<1777, T>(a);
   case 275:
-    return RadicalInverseSpecialized<1783>(a);
+    return RadicalInverseSpecialized<1783, T>(a);
   case 276:
-    return RadicalInverseSpecialized<1787>(a);
+    return RadicalInverseSpecialized<1787, T>(a);
   case 277:
-    return RadicalInverseSpecialized<1789>(a);
+    return RadicalInverseSpecialized<1789, T>(a);
   case 278:
-    return RadicalInverseSpecialized<1801>(a);
+    return RadicalInverseSpecialized<1801, T>(a);
   case 279:
-    return RadicalInverseSpecialized<1811>(a);
+    return RadicalInverseSpecialized<1811, T>(a);
   case 280:
-    return RadicalInverseSpecialized<1823>(a);
+    return RadicalInverseSpecialized<1823, T>(a);
   case 281:
-    return RadicalInverseSpecialized<1831>(a);
+    return RadicalInverseSpecialized<1831, T>(a);
   case 282:
-    return RadicalInverseSpecialized<1847>(a);
+    return RadicalInverseSpecialized<1847, T>(a);
   case 283:
-    return RadicalInverseSpecialized<1861>(a);
+    return RadicalInverseSpecialized<1861, T>(a);
   case 284:
-    return RadicalInverseSpecialized<1867>(a);
+    return RadicalInverseSpecialized<1867, T>(a);
   case 285:
-    return RadicalInverseSpecialized<1871>(a);
+    return RadicalInverseSpecialized<1871, T>(a);
   case 286:
-    return RadicalInverseSpecialized<1873>(a);
+    return RadicalInverseSpecialized<1873, T>(a);
   case 287:
-    return RadicalInverseSpecialized<1877>(a);
+    return RadicalInverseSpecialized<1877, T>(a);
   case 288:
-    return RadicalInverseSpecialized<1879>(a);
+    return RadicalInverseSpecialized<1879, T>(a);
   case 289:
-    return RadicalInverseSpecialized<1889>(a);
+    return RadicalInverseSpecialized<1889, T>(a);
   case 290:
-    return RadicalInverseSpecialized<1901>(a);
+    return RadicalInverseSpecialized<1901, T>(a);
   case 291:
-    return RadicalInverseSpecialized<1907>(a);
+    return RadicalInverseSpecialized<1907, T>(a);
   case 292:
-    return RadicalInverseSpecialized<1913>(a);
+    return RadicalInverseSpecialized<1913, T>(a);
   case 293:
-    return RadicalInverseSpecialized<1931>(a);
+    return RadicalInverseSpecialized<1931, T>(a);
   case 294:
-    return RadicalInverseSpecialized<1933>(a);
+    return RadicalInverseSpecialized<1933, T>(a);
   case 295:
-    return RadicalInverseSpecialized<1949>(a);
+    return RadicalInverseSpecialized<1949, T>(a);
   case 296:
-    return RadicalInverseSpecialized<1951>(a);
+    return RadicalInverseSpecialized<1951, T>(a);
   case 297:
-    return RadicalInverseSpecialized<1973>(a);
+    return RadicalInverseSpecialized<1973, T>(a);
   case 298:
-    return RadicalInverseSpecialized<1979>(a);
+    return RadicalInverseSpecialized<1979, T>(a);
   case 299:
-    return RadicalInverseSpecialized<1987>(a);
+    return RadicalInverseSpecialized<1987, T>(a);
   case 300:
-    return RadicalInverseSpecialized<1993>(a);
+    return RadicalInverseSpecialized<1993, T>(a);
   case 301:
-    return RadicalInverseSpecialized<1997>(a);
+    return RadicalInverseSpecialized<1997, T>(a);
   case 302:
-    return RadicalInverseSpecialized<1999>(a);
+    return RadicalInverseSpecialized<1999, T>(a);
   case 303:
-    return RadicalInverseSpecialized<2003>(a);
+    return RadicalInverseSpecialized<2003, T>(a);
   case 304:
-    return RadicalInverseSpecialized<2011>(a);
+    return RadicalInverseSpecialized<2011, T>(a);
   case 305:
-    return RadicalInverseSpecialized<2017>(a);
+    return RadicalInverseSpecialized<2017, T>(a);
   case 306:
-    return RadicalInverseSpecialized<2027>(a);
+    return RadicalInverseSpecialized<2027, T>(a);
   case 307:
-    return RadicalInverseSpecialized<2029>(a);
+    return RadicalInverseSpecialized<2029, T>(a);
   case 308:
-    return RadicalInverseSpecialized<2039>(a);
+    return RadicalInverseSpecialized<2039, T>(a);
   case 309:
-    return RadicalInverseSpecialized<2053>(a);
+    return RadicalInverseSpecialized<2053, T>(a);
   case 310:
-    return RadicalInverseSpecialized<2063>(a);
+    return RadicalInverseSpecialized<2063, T>(a);
   case 311:
-    return RadicalInverseSpecialized<2069>(a);
+    return RadicalInverseSpecialized<2069, T>(a);
   case 312:
-    return RadicalInverseSpecialized<2081>(a);
+    return RadicalInverseSpecialized<2081, T>(a);
   case 313:
-    return RadicalInverseSpecialized<2083>(a);
+    return RadicalInverseSpecialized<2083, T>(a);
   case 314:
-    return RadicalInverseSpecialized<2087>(a);
+    return RadicalInverseSpecialized<2087, T>(a);
   case 315:
-    return RadicalInverseSpecialized<2089>(a);
+    return RadicalInverseSpecialized<2089, T>(a);
   case 316:
-    return RadicalInverseSpecialized<2099>(a);
+    return RadicalInverseSpecialized<2099, T>(a);
   case 317:
-    return RadicalInverseSpecialized<2111>(a);
+    return RadicalInverseSpecialized<2111, T>(a);
   case 318:
-    return RadicalInverseSpecialized<2113>(a);
+    return RadicalInverseSpecialized<2113, T>(a);
   case 319:
-    return RadicalInverseSpecialized<2129>(a);
+    return RadicalInverseSpecialized<2129, T>(a);
   case 320:
-    return RadicalInverseSpecialized<2131>(a);
+    return RadicalInverseSpecialized<2131, T>(a);
   case 321:
-    return RadicalInverseSpecialized<2137>(a);
+    return RadicalInverseSpecialized<2137, T>(a);
   case 322:
-    return RadicalInverseSpecialized<2141>(a);
+    return RadicalInverseSpecialized<2141, T>(a);
   case 323:
-    return RadicalInverseSpecialized<2143>(a);
+    return RadicalInverseSpecialized<2143, T>(a);
   case 324:
-    return RadicalInverseSpecialized<2153>(a);
+    return RadicalInverseSpecialized<2153, T>(a);
   case 325:
-    return RadicalInverseSpecialized<2161>(a);
+    return RadicalInverseSpecialized<2161, T>(a);
   case 326:
-    return RadicalInverseSpecialized<2179>(a);
+    return RadicalInverseSpecialized<2179, T>(a);
   case 327:
-    return RadicalInverseSpecialized<2203>(a);
+    return RadicalInverseSpecialized<2203, T>(a);
   case 328:
-    return RadicalInverseSpecialized<2207>(a);
+    return RadicalInverseSpecialized<2207, T>(a);
   case 329:
-    return RadicalInverseSpecialized<2213>(a);
+    return RadicalInverseSpecialized<2213, T>(a);
   case 330:
-    return RadicalInverseSpecialized<2221>(a);
+    return RadicalInverseSpecialized<2221, T>(a);
   case 331:
-    return RadicalInverseSpecialized<2237>(a);
+    return RadicalInverseSpecialized<2237, T>(a);
   case 332:
-    return RadicalInverseSpecialized<2239>(a);
+    return RadicalInverseSpecialized<2239, T>(a);
   case 333:
-    return RadicalInverseSpecialized<2243>(a);
+    return RadicalInverseSpecialized<2243, T>(a);
   case 334:
-    return RadicalInverseSpecialized<2251>(a);
+    return RadicalInverseSpecialized<2251, T>(a);
   case 335:
-    return RadicalInverseSpecialized<2267>(a);
+    return RadicalInverseSpecialized<2267, T>(a);
   case 336:
-    return RadicalInverseSpecialized<2269>(a);
+    return RadicalInverseSpecialized<2269, T>(a);
   case 337:
-    return RadicalInverseSpecialized<2273>(a);
+    return RadicalInverseSpecialized<2273, T>(a);
   case 338:
-    return RadicalInverseSpecialized<2281>(a);
+    return RadicalInverseSpecialized<2281, T>(a);
   case 339:
-    return RadicalInverseSpecialized<2287>(a);
+    return RadicalInverseSpecialized<2287, T>(a);
   case 340:
-    return RadicalInverseSpecialized<2293>(a);
+    return RadicalInverseSpecialized<2293, T>(a);
   case 341:
-    return RadicalInverseSpecialized<2297>(a);
+    return RadicalInverseSpecialized<2297, T>(a);
   case 342:
-    return RadicalInverseSpecialized<2309>(a);
+    return RadicalInverseSpecialized<2309, T>(a);
   case 343:
-    return RadicalInverseSpecialized<2311>(a);
+    return RadicalInverseSpecialized<2311, T>(a);
   case 344:
-    return RadicalInverseSpecialized<2333>(a);
+    return RadicalInverseSpecialized<2333, T>(a);
   case 345:
-    return RadicalInverseSpecialized<2339>(a);
+    return RadicalInverseSpecialized<2339, T>(a);
   case 346:
-    return RadicalInverseSpecialized<2341>(a);
+    return RadicalInverseSpecialized<2341, T>(a);
   case 347:
-    return RadicalInverseSpecialized<2347>(a);
+    return RadicalInverseSpecialized<2347, T>(a);
   case 348:
-    return RadicalInverseSpecialized<2351>(a);
+    return RadicalInverseSpecialized<2351, T>(a);
   case 349:
-    return RadicalInverseSpecialized<2357>(a);
+    return RadicalInverseSpecialized<2357, T>(a);
   case 350:
-    return RadicalInverseSpecialized<2371>(a);
+    return RadicalInverseSpecialized<2371, T>(a);
   case 351:
-    return RadicalInverseSpecialized<2377>(a);
+    return RadicalInverseSpecialized<2377, T>(a);
   case 352:
-    return RadicalInverseSpecialized<2381>(a);
+    return RadicalInverseSpecialized<2381, T>(a);
   case 353:
-    return RadicalInverseSpecialized<2383>(a);
+    return RadicalInverseSpecialized<2383, T>(a);
   case 354:
-    return RadicalInverseSpecialized<2389>(a);
+    return RadicalInverseSpecialized<2389, T>(a);
   case 355:
-    return RadicalInverseSpecialized<2393>(a);
+    return RadicalInverseSpecialized<2393, T>(a);
   case 356:
-    return RadicalInverseSpecialized<2399>(a);
+    return RadicalInverseSpecialized<2399, T>(a);
   case 357:
-    return RadicalInverseSpecialized<2411>(a);
+    return RadicalInverseSpecialized<2411, T>(a);
   case 358:
-    return RadicalInverseSpecialized<2417>(a);
+    return RadicalInverseSpecialized<2417, T>(a);
   case 359:
-    return RadicalInverseSpecialized<2423>(a);
+    return RadicalInverseSpecialized<2423, T>(a);
   case 360:
-    return RadicalInverseSpecialized<2437>(a);
+    return RadicalInverseSpecialized<2437, T>(a);
   case 361:
-    return RadicalInverseSpecialized<2441>(a);
+    return RadicalInverseSpecialized<2441, T>(a);
   case 362:
-    return RadicalInverseSpecialized<2447>(a);
+    return RadicalInverseSpecialized<2447, T>(a);
   case 363:
-    return RadicalInverseSpecialized<2459>(a);
+    return RadicalInverseSpecialized<2459, T>(a);
   case 364:
-    return RadicalInverseSpecialized<2467>(a);
+    return RadicalInverseSpecialized<2467, T>(a);
   case 365:
-    return RadicalInverseSpecialized<2473>(a);
+    return RadicalInverseSpecialized<2473, T>(a);
   case 366:
-    return RadicalInverseSpecialized<2477>(a);
+    return RadicalInverseSpecialized<2477, T>(a);
   case 367:
-    return RadicalInverseSpecialized<2503>(a);
+    return RadicalInverseSpecialized<2503, T>(a);
   case 368:
-    return RadicalInverseSpecialized<2521>(a);
+    return RadicalInverseSpecialized<2521, T>(a);
   case 369:
-    return RadicalInverseSpecialized<2531>(a);
+    return RadicalInverseSpecialized<2531, T>(a);
   case 370:
-    return RadicalInverseSpecialized<2539>(a);
+    return RadicalInverseSpecialized<2539, T>(a);
   case 371:
-    return RadicalInverseSpecialized<2543>(a);
+    return RadicalInverseSpecialized<2543, T>(a);
   case 372:
-    return RadicalInverseSpecialized<2549>(a);
+    return RadicalInverseSpecialized<2549, T>(a);
   case 373:
-    return RadicalInverseSpecialized<2551>(a);
+    return RadicalInverseSpecialized<2551, T>(a);
   case 374:
-    return RadicalInverseSpecialized<2557>(a);
+    return RadicalInverseSpecialized<2557, T>(a);
   case 375:
-    return RadicalInverseSpecialized<2579>(a);
+    return RadicalInverseSpecialized<2579, T>(a);
   case 376:
-    return RadicalInverseSpecialized<2591>(a);
+    return RadicalInverseSpecialized<2591, T>(a);
   case 377:
-    return RadicalInverseSpecialized<2593>(a);
+    return RadicalInverseSpecialized<2593, T>(a);
   case 378:
-    return RadicalInverseSpecialized<2609>(a);
+    return RadicalInverseSpecialized<2609, T>(a);
   case 379:
-    return RadicalInverseSpecialized<2617>(a);
+    return RadicalInverseSpecialized<2617, T>(a);
   case 380:
-    return RadicalInverseSpecialized<2621>(a);
+    return RadicalInverseSpecialized<2621, T>(a);
   case 381:
-    return RadicalInverseSpecialized<2633>(a);
+    return RadicalInverseSpecialized<2633, T>(a);
   case 382:
-    return RadicalInverseSpecialized<2647>(a);
+    return RadicalInverseSpecialized<2647, T>(a);
   case 383:
-    return RadicalInverseSpecialized<2657>(a);
+    return RadicalInverseSpecialized<2657, T>(a);
   case 384:
-    return RadicalInverseSpecialized<2659>(a);
+    return RadicalInverseSpecialized<2659, T>(a);
   case 385:
-    return RadicalInverseSpecialized<2663>(a);
+    return RadicalInverseSpecialized<2663, T>(a);
   case 386:
-    return RadicalInverseSpecialized<2671>(a);
+    return RadicalInverseSpecialized<2671, T>(a);
   case 387:
-    return RadicalInverseSpecialized<2677>(a);
+    return RadicalInverseSpecialized<2677, T>(a);
   case 388:
-    return RadicalInverseSpecialized<2683>(a);
+    return RadicalInverseSpecialized<2683, T>(a);
   case 389:
-    return RadicalInverseSpecialized<2687>(a);
+    return RadicalInverseSpecialized<2687, T>(a);
   case 390:
-    return RadicalInverseSpecialized<2689>(a);
+    return RadicalInverseSpecialized<2689, T>(a);
   case 391:
-    return RadicalInverseSpecialized<2693>(a);
+    return RadicalInverseSpecialized<2693, T>(a);
   case 392:
-    return RadicalInverseSpecialized<2699>(a);
+    return RadicalInverseSpecialized<2699, T>(a);
   case 393:
-    return RadicalInverseSpecialized<2707>(a);
+    return RadicalInverseSpecialized<2707, T>(a);
   case 394:
-    return RadicalInverseSpecialized<2711>(a);
+    return RadicalInverseSpecialized<2711, T>(a);
   case 395:
-    return RadicalInverseSpecialized<2713>(a);
+    return RadicalInverseSpecialized<2713, T>(a);
   case 396:
-    return RadicalInverseSpecialized<2719>(a);
+    return RadicalInverseSpecialized<2719, T>(a);
   case 397:
-    return RadicalInverseSpecialized<2729>(a);
+    return RadicalInverseSpecialized<2729, T>(a);
   case 398:
-    return RadicalInverseSpecialized<2731>(a);
+    return RadicalInverseSpecialized<2731, T>(a);
   case 399:
-    return RadicalInverseSpecialized<2741>(a);
+    return RadicalInverseSpecialized<2741, T>(a);
   case 400:
-    return RadicalInverseSpecialized<2749>(a);
+    return RadicalInverseSpecialized<2749, T>(a);
   case 401:
-    return RadicalInverseSpecialized<2753>(a);
+    return RadicalInverseSpecialized<2753, T>(a);
   case 402:
-    return RadicalInverseSpecialized<2767>(a);
+    return RadicalInverseSpecialized<2767, T>(a);
   case 403:
-    return RadicalInverseSpecialized<2777>(a);
+    return RadicalInverseSpecialized<2777, T>(a);
   case 404:
-    return RadicalInverseSpecialized<2789>(a);
+    return RadicalInverseSpecialized<2789, T>(a);
   case 405:
-    return RadicalInverseSpecialized<2791>(a);
+    return RadicalInverseSpecialized<2791, T>(a);
   case 406:
-    return RadicalInverseSpecialized<2797>(a);
+    return RadicalInverseSpecialized<2797, T>(a);
   case 407:
-    return RadicalInverseSpecialized<2801>(a);
+    return RadicalInverseSpecialized<2801, T>(a);
   case 408:
-    return RadicalInverseSpecialized<2803>(a);
+    return RadicalInverseSpecialized<2803, T>(a);
   case 409:
-    return RadicalInverseSpecialized<2819>(a);
+    return RadicalInverseSpecialized<2819, T>(a);
   case 410:
-    return RadicalInverseSpecialized<2833>(a);
+    return RadicalInverseSpecialized<2833, T>(a);
   case 411:
-    return RadicalInverseSpecialized<2837>(a);
+    return RadicalInverseSpecialized<2837, T>(a);
   case 412:
-    return RadicalInverseSpecialized<2843>(a);
+    return RadicalInverseSpecialized<2843, T>(a);
   case 413:
-    return RadicalInverseSpecialized<2851>(a);
+    return RadicalInverseSpecialized<2851, T>(a);
   case 414:
-    return RadicalInverseSpecialized<2857>(a);
+    return RadicalInverseSpecialized<2857, T>(a);
   case 415:
-    return RadicalInverseSpecialized<2861>(a);
+    return RadicalInverseSpecialized<2861, T>(a);
   case 416:
-    return RadicalInverseSpecialized<2879>(a);
+    return RadicalInverseSpecialized<2879, T>(a);
   case 417:
-    return RadicalInverseSpecialized<2887>(a);
+    return RadicalInverseSpecialized<2887, T>(a);
   case 418:
-    return RadicalInverseSpecialized<2897>(a);
+    return RadicalInverseSpecialized<2897, T>(a);
   case 419:
-    return RadicalInverseSpecialized<2903>(a);
+    return RadicalInverseSpecialized<2903, T>(a);
   case 420:
-    return RadicalInverseSpecialized<2909>(a);
+    return RadicalInverseSpecialized<2909, T>(a);
   case 421:
-    return RadicalInverseSpecialized<2917>(a);
+    return RadicalInverseSpecialized<2917, T>(a);
   case 422:
-    return RadicalInverseSpecialized<2927>(a);
+    return RadicalInverseSpecialized<2927, T>(a);
   case 423:
-    return RadicalInverseSpecialized<2939>(a);
+    return RadicalInverseSpecialized<2939, T>(a);
   case 424:
-    return RadicalInverseSpecialized<2953>(a);
+    return RadicalInverseSpecialized<2953, T>(a);
   case 425:
-    return RadicalInverseSpecialized<2957>(a);
+    return RadicalInverseSpecialized<2957, T>(a);
   case 426:
-    return RadicalInverseSpecialized<2963>(a);
+    return RadicalInverseSpecialized<2963, T>(a);
   case 427:
-    return RadicalInverseSpecialized<2969>(a);
+    return RadicalInverseSpecialized<2969, T>(a);
   case 428:
-    return RadicalInverseSpecialized<2971>(a);
+    return RadicalInverseSpecialized<2971, T>(a);
   case 429:
-    return RadicalInverseSpecialized<2999>(a);
+    return RadicalInverseSpecialized<2999, T>(a);
   case 430:
-    return RadicalInverseSpecialized<3001>(a);
+    return RadicalInverseSpecialized<3001, T>(a);
   case 431:
-    return RadicalInverseSpecialized<3011>(a);
+    return RadicalInverseSpecialized<3011, T>(a);
   case 432:
-    return RadicalInverseSpecialized<3019>(a);
+    return RadicalInverseSpecialized<3019, T>(a);
   case 433:
-    return RadicalInverseSpecialized<3023>(a);
+    return RadicalInverseSpecialized<3023, T>(a);
   case 434:
-    return RadicalInverseSpecialized<3037>(a);
+    return RadicalInverseSpecialized<3037, T>(a);
   case 435:
-    return RadicalInverseSpecialized<3041>(a);
+    return RadicalInverseSpecialized<3041, T>(a);
   case 436:
-    return RadicalInverseSpecialized<3049>(a);
+    return RadicalInverseSpecialized<3049, T>(a);
   case 437:
-    return RadicalInverseSpecialized<3061>(a);
+    return RadicalInverseSpecialized<3061, T>(a);
   case 438:
-    return RadicalInverseSpecialized<3067>(a);
+    return RadicalInverseSpecialized<3067, T>(a);
   case 439:
-    return RadicalInverseSpecialized<3079>(a);
+    return RadicalInverseSpecialized<3079, T>(a);
   case 440:
-    return RadicalInverseSpecialized<3083>(a);
+    return RadicalInverseSpecialized<3083, T>(a);
   case 441:
-    return RadicalInverseSpecialized<3089>(a);
+    return RadicalInverseSpecialized<3089, T>(a);
   case 442:
-    return RadicalInverseSpecialized<3109>(a);
+    return RadicalInverseSpecialized<3109, T>(a);
   case 443:
-    return RadicalInverseSpecialized<3119>(a);
+    return RadicalInverseSpecialized<3119, T>(a);
   case 444:
-    return RadicalInverseSpecialized<3121>(a);
+    return RadicalInverseSpecialized<3121, T>(a);
   case 445:
-    return RadicalInverseSpecialized<3137>(a);
+    return RadicalInverseSpecialized<3137, T>(a);
   case 446:
-    return RadicalInverseSpecialized<3163>(a);
+    return RadicalInverseSpecialized<3163, T>(a);
   case 447:
-    return RadicalInverseSpecialized<3167>(a);
+    return RadicalInverseSpecialized<3167, T>(a);
   case 448:
-    return RadicalInverseSpecialized<3169>(a);
+    return RadicalInverseSpecialized<3169, T>(a);
   case 449:
-    return RadicalInverseSpecialized<3181>(a);
+    return RadicalInverseSpecialized<3181, T>(a);
   case 450:
-    return RadicalInverseSpecialized<3187>(a);
+    return RadicalInverseSpecialized<3187, T>(a);
   case 451:
-    return RadicalInverseSpecialized<3191>(a);
+    return RadicalInverseSpecialized<3191, T>(a);
   case 452:
-    return RadicalInverseSpecialized<3203>(a);
+    return RadicalInverseSpecialized<3203, T>(a);
   case 453:
-    return RadicalInverseSpecialized<3209>(a);
+    return RadicalInverseSpecialized<3209, T>(a);
   case 454:
-    return RadicalInverseSpecialized<3217>(a);
+    return RadicalInverseSpecialized<3217, T>(a);
   case 455:
-    return RadicalInverseSpecialized<3221>(a);
+    return RadicalInverseSpecialized<3221, T>(a);
   case 456:
-    return RadicalInverseSpecialized<3229>(a);
+    return RadicalInverseSpecialized<3229, T>(a);
   case 457:
-    return RadicalInverseSpecialized<3251>(a);
+    return RadicalInverseSpecialized<3251, T>(a);
   case 458:
-    return RadicalInverseSpecialized<3253>(a);
+    return RadicalInverseSpecialized<3253, T>(a);
   case 459:
-    return RadicalInverseSpecialized<3257>(a);
+    return RadicalInverseSpecialized<3257, T>(a);
   case 460:
-    return RadicalInverseSpecialized<3259>(a);
+    return RadicalInverseSpecialized<3259, T>(a);
   case 461:
-    return RadicalInverseSpecialized<3271>(a);
+    return RadicalInverseSpecialized<3271, T>(a);
   case 462:
-    return RadicalInverseSpecialized<3299>(a);
+    return RadicalInverseSpecialized<3299, T>(a);
   case 463:
-    return RadicalInverseSpecialized<3301>(a);
+    return RadicalInverseSpecialized<3301, T>(a);
   case 464:
-    return RadicalInverseSpecialized<3307>(a);
+    return RadicalInverseSpecialized<3307, T>(a);
   case 465:
-    return RadicalInverseSpecialized<3313>(a);
+    return RadicalInverseSpecialized<3313, T>(a);
   case 466:
-    return RadicalInverseSpecialized<3319>(a);
+    return RadicalInverseSpecialized<3319, T>(a);
   case 467:
-    return RadicalInverseSpecialized<3323>(a);
+    return RadicalInverseSpecialized<3323, T>(a);
   case 468:
-    return RadicalInverseSpecialized<3329>(a);
+    return RadicalInverseSpecialized<3329, T>(a);
   case 469:
-    return RadicalInverseSpecialized<3331>(a);
+    return RadicalInverseSpecialized<3331, T>(a);
   case 470:
-    return RadicalInverseSpecialized<3343>(a);
+    return RadicalInverseSpecialized<3343, T>(a);
   case 471:
-    return RadicalInverseSpecialized<3347>(a);
+    return RadicalInverseSpecialized<3347, T>(a);
   case 472:
-    return RadicalInverseSpecialized<3359>(a);
+    return RadicalInverseSpecialized<3359, T>(a);
   case 473:
-    return RadicalInverseSpecialized<3361>(a);
+    return RadicalInverseSpecialized<3361, T>(a);
   case 474:
-    return RadicalInverseSpecialized<3371>(a);
+    return RadicalInverseSpecialized<3371, T>(a);
   case 475:
-    return RadicalInverseSpecialized<3373>(a);
+    return RadicalInverseSpecialized<3373, T>(a);
   case 476:
-    return RadicalInverseSpecialized<3389>(a);
+    return RadicalInverseSpecialized<3389, T>(a);
   case 477:
-    return RadicalInverseSpecialized<3391>(a);
+    return RadicalInverseSpecialized<3391, T>(a);
   case 478:
-    return RadicalInverseSpecialized<3407>(a);
+    return RadicalInverseSpecialized<3407, T>(a);
   case 479:
-    return RadicalInverseSpecialized<3413>(a);
+    return RadicalInverseSpecialized<3413, T>(a);
   case 480:
-    return RadicalInverseSpecialized<3433>(a);
+    return RadicalInverseSpecialized<3433, T>(a);
   case 481:
-    return RadicalInverseSpecialized<3449>(a);
+    return RadicalInverseSpecialized<3449, T>(a);
   case 482:
-    return RadicalInverseSpecialized<3457>(a);
+    return RadicalInverseSpecialized<3457, T>(a);
   case 483:
-    return RadicalInverseSpecialized<3461>(a);
+    return RadicalInverseSpecialized<3461, T>(a);
   case 484:
-    return RadicalInverseSpecialized<3463>(a);
+    return RadicalInverseSpecialized<3463, T>(a);
   case 485:
-    return RadicalInverseSpecialized<3467>(a);
+    return RadicalInverseSpecialized<3467, T>(a);
   case 486:
-    return RadicalInverseSpecialized<3469>(a);
+    return RadicalInverseSpecialized<3469, T>(a);
   case 487:
-    return RadicalInverseSpecialized<3491>(a);
+    return RadicalInverseSpecialized<3491, T>(a);
   case 488:
-    return RadicalInverseSpecialized<3499>(a);
+    return RadicalInverseSpecialized<3499, T>(a);
   case 489:
-    return RadicalInverseSpecialized<3511>(a);
+    return RadicalInverseSpecialized<3511, T>(a);
   case 490:
-    return RadicalInverseSpecialized<3517>(a);
+    return RadicalInverseSpecialized<3517, T>(a);
   case 491:
-    return RadicalInverseSpecialized<3527>(a);
+    return RadicalInverseSpecialized<3527, T>(a);
   case 492:
-    return RadicalInverseSpecialized<3529>(a);
+    return RadicalInverseSpecialized<3529, T>(a);
   case 493:
-    return RadicalInverseSpecialized<3533>(a);
+    return RadicalInverseSpecialized<3533, T>(a);
   case 494:
-    return RadicalInverseSpecialized<3539>(a);
+    return RadicalInverseSpecialized<3539, T>(a);
   case 495:
-    return RadicalInverseSpecialized<3541>(a);
+    return RadicalInverseSpecialized<3541, T>(a);
   case 496:
-    return RadicalInverseSpecialized<3547>(a);
+    return RadicalInverseSpecialized<3547, T>(a);
   case 497:
-    return RadicalInverseSpecialized<3557>(a);
+    return RadicalInverseSpecialized<3557, T>(a);
   case 498:
-    return RadicalInverseSpecialized<3559>(a);
+    return RadicalInverseSpecialized<3559, T>(a);
   case 499:
-    return RadicalInverseSpecialized<3571>(a);
+    return RadicalInverseSpecialized<3571, T>(a);
   case 500:
-    return RadicalInverseSpecialized<3581>(a);
+    return RadicalInverseSpecialized<3581, T>(a);
   case 501:
-    return RadicalInverseSpecialized<3583>(a);
+    return RadicalInverseSpecialized<3583, T>(a);
   case 502:
-    return RadicalInverseSpecialized<3593>(a);
+    return RadicalInverseSpecialized<3593, T>(a);
   case 503:
-    return RadicalInverseSpecialized<3607>(a);
+    return RadicalInverseSpecialized<3607, T>(a);
   case 504:
-    return RadicalInverseSpecialized<3613>(a);
+    return RadicalInverseSpecialized<3613, T>(a);
   case 505:
-    return RadicalInverseSpecialized<3617>(a);
+    return RadicalInverseSpecialized<3617, T>(a);
   case 506:
-    return RadicalInverseSpecialized<3623>(a);
+    return RadicalInverseSpecialized<3623, T>(a);
   case 507:
-    return RadicalInverseSpecialized<3631>(a);
+    return RadicalInverseSpecialized<3631, T>(a);
   case 508:
-    return RadicalInverseSpecialized<3637>(a);
+    return RadicalInverseSpecialized<3637, T>(a);
   case 509:
-    return RadicalInverseSpecialized<3643>(a);
+    return RadicalInverseSpecialized<3643, T>(a);
   case 510:
-    return RadicalInverseSpecialized<3659>(a);
+    return RadicalInverseSpecialized<3659, T>(a);
   case 511:
-    return RadicalInverseSpecialized<3671>(a);
+    return RadicalInverseSpecialized<3671, T>(a);
   case 512:
-    return RadicalInverseSpecialized<3673>(a);
+    return RadicalInverseSpecialized<3673, T>(a);
   case 513:
-    return RadicalInverseSpecialized<3677>(a);
+    return RadicalInverseSpecialized<3677, T>(a);
   case 514:
-    return RadicalInverseSpecialized<3691>(a);
+    return RadicalInverseSpecialized<3691, T>(a);
   case 515:
-    return RadicalInverseSpecialized<3697>(a);
+    return RadicalInverseSpecialized<3697, T>(a);
   case 516:
-    return RadicalInverseSpecialized<3701>(a);
+    return RadicalInverseSpecialized<3701, T>(a);
   case 517:
-    return RadicalInverseSpecialized<3709>(a);
+    return RadicalInverseSpecialized<3709, T>(a);
   case 518:
-    return RadicalInverseSpecialized<3719>(a);
+    return RadicalInverseSpecialized<3719, T>(a);
   case 519:
-    return RadicalInverseSpecialized<3727>(a);
+    return RadicalInverseSpecialized<3727, T>(a);
   case 520:
-    return RadicalInverseSpecialized<3733>(a);
+    return RadicalInverseSpecialized<3733, T>(a);
   case 521:
-    return RadicalInverseSpecialized<3739>(a);
+    return RadicalInverseSpecialized<3739, T>(a);
   case 522:
-    return RadicalInverseSpecialized<3761>(a);
+    return RadicalInverseSpecialized<3761, T>(a);
   case 523:
-    return RadicalInverseSpecialized<3767>(a);
+    return RadicalInverseSpecialized<3767, T>(a);
   case 524:
-    return RadicalInverseSpecialized<3769>(a);
+    return RadicalInverseSpecialized<3769, T>(a);
   case 525:
-    return RadicalInverseSpecialized<3779>(a);
+    return RadicalInverseSpecialized<3779, T>(a);
   case 526:
-    return RadicalInverseSpecialized<3793>(a);
+    return RadicalInverseSpecialized<3793, T>(a);
   case 527:
-    return RadicalInverseSpecialized<3797>(a);
+    return RadicalInverseSpecialized<3797, T>(a);
   case 528:
-    return RadicalInverseSpecialized<3803>(a);
+    return RadicalInverseSpecialized<3803, T>(a);
   case 529:
-    return RadicalInverseSpecialized<3821>(a);
+    return RadicalInverseSpecialized<3821, T>(a);
   case 530:
-    return RadicalInverseSpecialized<3823>(a);
+    return RadicalInverseSpecialized<3823, T>(a);
   case 531:
-    return RadicalInverseSpecialized<3833>(a);
+    return RadicalInverseSpecialized<3833, T>(a);
   case 532:
-    return RadicalInverseSpecialized<3847>(a);
+    return RadicalInverseSpecialized<3847, T>(a);
   case 533:
-    return RadicalInverseSpecialized<3851>(a);
+    return RadicalInverseSpecialized<3851, T>(a);
   case 534:
-    return RadicalInverseSpecialized<3853>(a);
+    return RadicalInverseSpecialized<3853, T>(a);
   case 535:
-    return RadicalInverseSpecialized<3863>(a);
+    return RadicalInverseSpecialized<3863, T>(a);
   case 536:
-    return RadicalInverseSpecialized<3877>(a);
+    return RadicalInverseSpecialized<3877, T>(a);
   case 537:
-    return RadicalInverseSpecialized<3881>(a);
+    return RadicalInverseSpecialized<3881, T>(a);
   case 538:
-    return RadicalInverseSpecialized<3889>(a);
+    return RadicalInverseSpecialized<3889, T>(a);
   case 539:
-    return RadicalInverseSpecialized<3907>(a);
+    return RadicalInverseSpecialized<3907, T>(a);
   case 540:
-    return RadicalInverseSpecialized<3911>(a);
+    return RadicalInverseSpecialized<3911, T>(a);
   case 541:
-    return RadicalInverseSpecialized<3917>(a);
+    return RadicalInverseSpecialized<3917, T>(a);
   case 542:
-    return RadicalInverseSpecialized<3919>(a);
+    return RadicalInverseSpecialized<3919, T>(a);
   case 543:
-    return RadicalInverseSpecialized<3923>(a);
+    return RadicalInverseSpecialized<3923, T>(a);
   case 544:
-    return RadicalInverseSpecialized<3929>(a);
+    return RadicalInverseSpecialized<3929, T>(a);
   case 545:
-    return RadicalInverseSpecialized<3931>(a);
+    return RadicalInverseSpecialized<3931, T>(a);
   case 546:
-    return RadicalInverseSpecialized<3943>(a);
+    return RadicalInverseSpecialized<3943, T>(a);
   case 547:
-    return RadicalInverseSpecialized<3947>(a);
+    return RadicalInverseSpecialized<3947, T>(a);
   case 548:
-    return RadicalInverseSpecialized<3967>(a);
+    return RadicalInverseSpecialized<3967, T>(a);
   case 549:
-    return RadicalInverseSpecialized<3989>(a);
+    return RadicalInverseSpecialized<3989, T>(a);
   case 550:
-    return RadicalInverseSpecialized<4001>(a);
+    return RadicalInverseSpecialized<4001, T>(a);
   case 551:
-    return RadicalInverseSpecialized<4003>(a);
+    return RadicalInverseSpecialized<4003, T>(a);
   case 552:
-    return RadicalInverseSpecialized<4007>(a);
+    return RadicalInverseSpecialized<4007, T>(a);
   case 553:
-    return RadicalInverseSpecialized<4013>(a);
+    return RadicalInverseSpecialized<4013, T>(a);
   case 554:
-    return RadicalInverseSpecialized<4019>(a);
+    return RadicalInverseSpecialized<4019, T>(a);
   case 555:
-    return RadicalInverseSpecialized<4021>(a);
+    return RadicalInverseSpecialized<4021, T>(a);
   case 556:
-    return RadicalInverseSpecialized<4027>(a);
+    return RadicalInverseSpecialized<4027, T>(a);
   case 557:
-    return RadicalInverseSpecialized<4049>(a);
+    return RadicalInverseSpecialized<4049, T>(a);
   case 558:
-    return RadicalInverseSpecialized<4051>(a);
+    return RadicalInverseSpecialized<4051, T>(a);
   case 559:
-    return RadicalInverseSpecialized<4057>(a);
+    return RadicalInverseSpecialized<4057, T>(a);
   case 560:
-    return RadicalInverseSpecialized<4073>(a);
+    return RadicalInverseSpecialized<4073, T>(a);
   case 561:
-    return RadicalInverseSpecialized<4079>(a);
+    return RadicalInverseSpecialized<4079, T>(a);
   case 562:
-    return RadicalInverseSpecialized<4091>(a);
+    return RadicalInverseSpecialized<4091, T>(a);
   case 563:
-    return RadicalInverseSpecialized<4093>(a);
+    return RadicalInverseSpecialized<4093, T>(a);
   case 564:
-    return RadicalInverseSpecialized<4099>(a);
+    return RadicalInverseSpecialized<4099, T>(a);
   case 565:
-    return RadicalInverseSpecialized<4111>(a);
+    return RadicalInverseSpecialized<4111, T>(a);
   case 566:
-    return RadicalInverseSpecialized<4127>(a);
+    return RadicalInverseSpecialized<4127, T>(a);
   case 567:
-    return RadicalInverseSpecialized<4129>(a);
+    return RadicalInverseSpecialized<4129, T>(a);
   case 568:
-    return RadicalInverseSpecialized<4133>(a);
+    return RadicalInverseSpecialized<4133, T>(a);
   case 569:
-    return RadicalInverseSpecialized<4139>(a);
+    return RadicalInverseSpecialized<4139, T>(a);
   case 570:
-    return RadicalInverseSpecialized<4153>(a);
+    return RadicalInverseSpecialized<4153, T>(a);
   case 571:
-    return RadicalInverseSpecialized<4157>(a);
+    return RadicalInverseSpecialized<4157, T>(a);
   case 572:
-    return RadicalInverseSpecialized<4159>(a);
+    return RadicalInverseSpecialized<4159, T>(a);
   case 573:
-    return RadicalInverseSpecialized<4177>(a);
+    return RadicalInverseSpecialized<4177, T>(a);
   case 574:
-    return RadicalInverseSpecialized<4201>(a);
+    return RadicalInverseSpecialized<4201, T>(a);
   case 575:
-    return RadicalInverseSpecialized<4211>(a);
+    return RadicalInverseSpecialized<4211, T>(a);
   case 576:
-    return RadicalInverseSpecialized<4217>(a);
+    return RadicalInverseSpecialized<4217, T>(a);
   case 577:
-    return RadicalInverseSpecialized<4219>(a);
+    return RadicalInverseSpecialized<4219, T>(a);
   case 578:
-    return RadicalInverseSpecialized<4229>(a);
+    return RadicalInverseSpecialized<4229, T>(a);
   case 579:
-    return RadicalInverseSpecialized<4231>(a);
+    return RadicalInverseSpecialized<4231, T>(a);
   case 580:
-    return RadicalInverseSpecialized<4241>(a);
+    return RadicalInverseSpecialized<4241, T>(a);
   case 581:
-    return RadicalInverseSpecialized<4243>(a);
+    return RadicalInverseSpecialized<4243, T>(a);
   case 582:
-    return RadicalInverseSpecialized<4253>(a);
+    return RadicalInverseSpecialized<4253, T>(a);
   case 583:
-    return RadicalInverseSpecialized<4259>(a);
+    return RadicalInverseSpecialized<4259, T>(a);
   case 584:
-    return RadicalInverseSpecialized<4261>(a);
+    return RadicalInverseSpecialized<4261, T>(a);
   case 585:
-    return RadicalInverseSpecialized<4271>(a);
+    return RadicalInverseSpecialized<4271, T>(a);
   case 586:
-    return RadicalInverseSpecialized<4273>(a);
+    return RadicalInverseSpecialized<4273, T>(a);
   case 587:
-    return RadicalInverseSpecialized<4283>(a);
+    return RadicalInverseSpecialized<4283, T>(a);
   case 588:
-    return RadicalInverseSpecialized<4289>(a);
+    return RadicalInverseSpecialized<4289, T>(a);
   case 589:
-    return RadicalInverseSpecialized<4297>(a);
+    return RadicalInverseSpecialized<4297, T>(a);
   case 590:
-    return RadicalInverseSpecialized<4327>(a);
+    return RadicalInverseSpecialized<4327, T>(a);
   case 591:
-    return RadicalInverseSpecialized<4337>(a);
+    return RadicalInverseSpecialized<4337, T>(a);
   case 592:
-    return RadicalInverseSpecialized<4339>(a);
+    return RadicalInverseSpecialized<4339, T>(a);
   case 593:
-    return RadicalInverseSpecialized<4349>(a);
+    return RadicalInverseSpecialized<4349, T>(a);
   case 594:
-    return RadicalInverseSpecialized<4357>(a);
+    return RadicalInverseSpecialized<4357, T>(a);
   case 595:
-    return RadicalInverseSpecialized<4363>(a);
+    return RadicalInverseSpecialized<4363, T>(a);
   case 596:
-    return RadicalInverseSpecialized<4373>(a);
+    return RadicalInverseSpecialized<4373, T>(a);
   case 597:
-    return RadicalInverseSpecialized<4391>(a);
+    return RadicalInverseSpecialized<4391, T>(a);
   case 598:
-    return RadicalInverseSpecialized<4397>(a);
+    return RadicalInverseSpecialized<4397, T>(a);
   case 599:
-    return RadicalInverseSpecialized<4409>(a);
+    return RadicalInverseSpecialized<4409, T>(a);
   case 600:
-    return RadicalInverseSpecialized<4421>(a);
+    return RadicalInverseSpecialized<4421, T>(a);
   case 601:
-    return RadicalInverseSpecialized<4423>(a);
+    return RadicalInverseSpecialized<4423, T>(a);
   case 602:
-    return RadicalInverseSpecialized<4441>(a);
+    return RadicalInverseSpecialized<4441, T>(a);
   case 603:
-    return RadicalInverseSpecialized<4447>(a);
+    return RadicalInverseSpecialized<4447, T>(a);
   case 604:
-    return RadicalInverseSpecialized<4451>(a);
+    return RadicalInverseSpecialized<4451, T>(a);
   case 605:
-    return RadicalInverseSpecialized<4457>(a);
+    return RadicalInverseSpecialized<4457, T>(a);
   case 606:
-    return RadicalInverseSpecialized<4463>(a);
+    return RadicalInverseSpecialized<4463, T>(a);
   case 607:
-    return RadicalInverseSpecialized<4481>(a);
+    return RadicalInverseSpecialized<4481, T>(a);
   case 608:
-    return RadicalInverseSpecialized<4483>(a);
+    return RadicalInverseSpecialized<4483, T>(a);
   case 609:
-    return RadicalInverseSpecialized<4493>(a);
+    return RadicalInverseSpecialized<4493, T>(a);
   case 610:
-    return RadicalInverseSpecialized<4507>(a);
+    return RadicalInverseSpecialized<4507, T>(a);
   case 611:
-    return RadicalInverseSpecialized<4513>(a);
+    return RadicalInverseSpecialized<4513, T>(a);
   case 612:
-    return RadicalInverseSpecialized<4517>(a);
+    return RadicalInverseSpecialized<4517, T>(a);
   case 613:
-    return RadicalInverseSpecialized<4519>(a);
+    return RadicalInverseSpecialized<4519, T>(a);
   case 614:
-    return RadicalInverseSpecialized<4523>(a);
+    return RadicalInverseSpecialized<4523, T>(a);
   case 615:
-    return RadicalInverseSpecialized<4547>(a);
+    return RadicalInverseSpecialized<4547, T>(a);
   case 616:
-    return RadicalInverseSpecialized<4549>(a);
+    return RadicalInverseSpecialized<4549, T>(a);
   case 617:
-    return RadicalInverseSpecialized<4561>(a);
+    return RadicalInverseSpecialized<4561, T>(a);
   case 618:
-    return RadicalInverseSpecialized<4567>(a);
+    return RadicalInverseSpecialized<4567, T>(a);
   case 619:
-    return RadicalInverseSpecialized<4583>(a);
+    return RadicalInverseSpecialized<4583, T>(a);
   case 620:
-    return RadicalInverseSpecialized<4591>(a);
+    return RadicalInverseSpecialized<4591, T>(a);
   case 621:
-    return RadicalInverseSpecialized<4597>(a);
+    return RadicalInverseSpecialized<4597, T>(a);
   case 622:
-    return RadicalInverseSpecialized<4603>(a);
+    return RadicalInverseSpecialized<4603, T>(a);
   case 623:
-    return RadicalInverseSpecialized<4621>(a);
+    return RadicalInverseSpecialized<4621, T>(a);
   case 624:
-    return RadicalInverseSpecialized<4637>(a);
+    return RadicalInverseSpecialized<4637, T>(a);
   case 625:
-    return RadicalInverseSpecialized<4639>(a);
+    return RadicalInverseSpecialized<4639, T>(a);
   case 626:
-    return RadicalInverseSpecialized<4643>(a);
+    return RadicalInverseSpecialized<4643, T>(a);
   case 627:
-    return RadicalInverseSpecialized<4649>(a);
+    return RadicalInverseSpecialized<4649, T>(a);
   case 628:
-    return RadicalInverseSpecialized<4651>(a);
+    return RadicalInverseSpecialized<4651, T>(a);
   case 629:
-    return RadicalInverseSpecialized<4657>(a);
+    return RadicalInverseSpecialized<4657, T>(a);
   case 630:
-    return RadicalInverseSpecialized<4663>(a);
+    return RadicalInverseSpecialized<4663, T>(a);
   case 631:
-    return RadicalInverseSpecialized<4673>(a);
+    return RadicalInverseSpecialized<4673, T>(a);
   case 632:
-    return RadicalInverseSpecialized<4679>(a);
+    return RadicalInverseSpecialized<4679, T>(a);
   case 633:
-    return RadicalInverseSpecialized<4691>(a);
+    return RadicalInverseSpecialized<4691, T>(a);
   case 634:
-    return RadicalInverseSpecialized<4703>(a);
+    return RadicalInverseSpecialized<4703, T>(a);
   case 635:
-    return RadicalInverseSpecialized<4721>(a);
+    return RadicalInverseSpecialized<4721, T>(a);
   case 636:
-    return RadicalInverseSpecialized<4723>(a);
+    return RadicalInverseSpecialized<4723, T>(a);
   case 637:
-    return RadicalInverseSpecialized<4729>(a);
+    return RadicalInverseSpecialized<4729, T>(a);
   case 638:
-    return RadicalInverseSpecialized<4733>(a);
+    return RadicalInverseSpecialized<4733, T>(a);
   case 639:
-    return RadicalInverseSpecialized<4751>(a);
+    return RadicalInverseSpecialized<4751, T>(a);
   case 640:
-    return RadicalInverseSpecialized<4759>(a);
+    return RadicalInverseSpecialized<4759, T>(a);
   case 641:
-    return RadicalInverseSpecialized<4783>(a);
+    return RadicalInverseSpecialized<4783, T>(a);
   case 642:
-    return RadicalInverseSpecialized<4787>(a);
+    return RadicalInverseSpecialized<4787, T>(a);
   case 643:
-    return RadicalInverseSpecialized<4789>(a);
+    return RadicalInverseSpecialized<4789, T>(a);
   case 644:
-    return RadicalInverseSpecialized<4793>(a);
+    return RadicalInverseSpecialized<4793, T>(a);
   case 645:
-    return RadicalInverseSpecialized<4799>(a);
+    return RadicalInverseSpecialized<4799, T>(a);
   case 646:
-    return RadicalInverseSpecialized<4801>(a);
+    return RadicalInverseSpecialized<4801, T>(a);
   case 647:
-    return RadicalInverseSpecialized<4813>(a);
+    return RadicalInverseSpecialized<4813, T>(a);
   case 648:
-    return RadicalInverseSpecialized<4817>(a);
+    return RadicalInverseSpecialized<4817, T>(a);
   case 649:
-    return RadicalInverseSpecialized<4831>(a);
+    return RadicalInverseSpecialized<4831, T>(a);
   case 650:
-    return RadicalInverseSpecialized<4861>(a);
+    return RadicalInverseSpecialized<4861, T>(a);
   case 651:
-    return RadicalInverseSpecialized<4871>(a);
+    return RadicalInverseSpecialized<4871, T>(a);
   case 652:
-    return RadicalInverseSpecialized<4877>(a);
+    return RadicalInverseSpecialized<4877, T>(a);
   case 653:
-    return RadicalInverseSpecialized<4889>(a);
+    return RadicalInverseSpecialized<4889, T>(a);
   case 654:
-    return RadicalInverseSpecialized<4903>(a);
+    return RadicalInverseSpecialized<4903, T>(a);
   case 655:
-    return RadicalInverseSpecialized<4909>(a);
+    return RadicalInverseSpecialized<4909, T>(a);
   case 656:
-    return RadicalInverseSpecialized<4919>(a);
+    return RadicalInverseSpecialized<4919, T>(a);
   case 657:
-    return RadicalInverseSpecialized<4931>(a);
+    return RadicalInverseSpecialized<4931, T>(a);
   case 658:
-    return RadicalInverseSpecialized<4933>(a);
+    return RadicalInverseSpecialized<4933, T>(a);
   case 659:
-    return RadicalInverseSpecialized<4937>(a);
+    return RadicalInverseSpecialized<4937, T>(a);
   case 660:
-    return RadicalInverseSpecialized<4943>(a);
+    return RadicalInverseSpecialized<4943, T>(a);
   case 661:
-    return RadicalInverseSpecialized<4951>(a);
+    return RadicalInverseSpecialized<4951, T>(a);
   case 662:
-    return RadicalInverseSpecialized<4957>(a);
+    return RadicalInverseSpecialized<4957, T>(a);
   case 663:
-    return RadicalInverseSpecialized<4967>(a);
+    return RadicalInverseSpecialized<4967, T>(a);
   case 664:
-    return RadicalInverseSpecialized<4969>(a);
+    return RadicalInverseSpecialized<4969, T>(a);
   case 665:
-    return RadicalInverseSpecialized<4973>(a);
+    return RadicalInverseSpecialized<4973, T>(a);
   case 666:
-    return RadicalInverseSpecialized<4987>(a);
+    return RadicalInverseSpecialized<4987, T>(a);
   case 667:
-    return RadicalInverseSpecialized<4993>(a);
+    return RadicalInverseSpecialized<4993, T>(a);
   case 668:
-    return RadicalInverseSpecialized<4999>(a);
+    return RadicalInverseSpecialized<4999, T>(a);
   case 669:
-    return RadicalInverseSpecialized<5003>(a);
+    return RadicalInverseSpecialized<5003, T>(a);
   case 670:
-    return RadicalInverseSpecialized<5009>(a);
+    return RadicalInverseSpecialized<5009, T>(a);
   case 671:
-    return RadicalInverseSpecialized<5011>(a);
+    return RadicalInverseSpecialized<5011, T>(a);
   case 672:
-    return RadicalInverseSpecialized<5021>(a);
+    return RadicalInverseSpecialized<5021, T>(a);
   case 673:
-    return RadicalInverseSpecialized<5023>(a);
+    return RadicalInverseSpecialized<5023, T>(a);
   case 674:
-    return RadicalInverseSpecialized<5039>(a);
+    return RadicalInverseSpecialized<5039, T>(a);
   case 675:
-    return RadicalInverseSpecialized<5051>(a);
+    return RadicalInverseSpecialized<5051, T>(a);
   case 676:
-    return RadicalInverseSpecialized<5059>(a);
+    return RadicalInverseSpecialized<5059, T>(a);
   case 677:
-    return RadicalInverseSpecialized<5077>(a);
+    return RadicalInverseSpecialized<5077, T>(a);
   case 678:
-    return RadicalInverseSpecialized<5081>(a);
+    return RadicalInverseSpecialized<5081, T>(a);
   case 679:
-    return RadicalInverseSpecialized<5087>(a);
+    return RadicalInverseSpecialized<5087, T>(a);
   case 680:
-    return RadicalInverseSpecialized<5099>(a);
+    return RadicalInverseSpecialized<5099, T>(a);
   case 681:
-    return RadicalInverseSpecialized<5101>(a);
+    return RadicalInverseSpecialized<5101, T>(a);
   case 682:
-    return RadicalInverseSpecialized<5107>(a);
+    return RadicalInverseSpecialized<5107, T>(a);
   case 683:
-    return RadicalInverseSpecialized<5113>(a);
+    return RadicalInverseSpecialized<5113, T>(a);
   case 684:
-    return RadicalInverseSpecialized<5119>(a);
+    return RadicalInverseSpecialized<5119, T>(a);
   case 685:
-    return RadicalInverseSpecialized<5147>(a);
+    return RadicalInverseSpecialized<5147, T>(a);
   case 686:
-    return RadicalInverseSpecialized<5153>(a);
+    return RadicalInverseSpecialized<5153, T>(a);
   case 687:
-    return RadicalInverseSpecialized<5167>(a);
+    return RadicalInverseSpecialized<5167, T>(a);
   case 688:
-    return RadicalInverseSpecialized<5171>(a);
+    return RadicalInverseSpecialized<5171, T>(a);
   case 689:
-    return RadicalInverseSpecialized<5179>(a);
+    return RadicalInverseSpecialized<5179, T>(a);
   case 690:
-    return RadicalInverseSpecialized<5189>(a);
+    return RadicalInverseSpecialized<5189, T>(a);
   case 691:
-    return RadicalInverseSpecialized<5197>(a);
+    return RadicalInverseSpecialized<5197, T>(a);
   case 692:
-    return RadicalInverseSpecialized<5209>(a);
+    return RadicalInverseSpecialized<5209, T>(a);
   case 693:
-    return RadicalInverseSpecialized<5227>(a);
+    return RadicalInverseSpecialized<5227, T>(a);
   case 694:
-    return RadicalInverseSpecialized<5231>(a);
+    return RadicalInverseSpecialized<5231, T>(a);
   case 695:
-    return RadicalInverseSpecialized<5233>(a);
+    return RadicalInverseSpecialized<5233, T>(a);
   case 696:
-    return RadicalInverseSpecialized<5237>(a);
+    return RadicalInverseSpecialized<5237, T>(a);
   case 697:
-    return RadicalInverseSpecialized<5261>(a);
+    return RadicalInverseSpecialized<5261, T>(a);
   case 698:
-    return RadicalInverseSpecialized<5273>(a);
+    return RadicalInverseSpecialized<5273, T>(a);
   case 699:
-    return RadicalInverseSpecialized<5279>(a);
+    return RadicalInverseSpecialized<5279, T>(a);
   case 700:
-    return RadicalInverseSpecialized<5281>(a);
+    return RadicalInverseSpecialized<5281, T>(a);
   case 701:
-    return RadicalInverseSpecialized<5297>(a);
+    return RadicalInverseSpecialized<5297, T>(a);
   case 702:
-    return RadicalInverseSpecialized<5303>(a);
+    return RadicalInverseSpecialized<5303, T>(a);
   case 703:
-    return RadicalInverseSpecialized<5309>(a);
+    return RadicalInverseSpecialized<5309, T>(a);
   case 704:
-    return RadicalInverseSpecialized<5323>(a);
+    return RadicalInverseSpecialized<5323, T>(a);
   case 705:
-    return RadicalInverseSpecialized<5333>(a);
+    return RadicalInverseSpecialized<5333, T>(a);
   case 706:
-    return RadicalInverseSpecialized<5347>(a);
+    return RadicalInverseSpecialized<5347, T>(a);
   case 707:
-    return RadicalInverseSpecialized<5351>(a);
+    return RadicalInverseSpecialized<5351, T>(a);
   case 708:
-    return RadicalInverseSpecialized<5381>(a);
+    return RadicalInverseSpecialized<5381, T>(a);
   case 709:
-    return RadicalInverseSpecialized<5387>(a);
+    return RadicalInverseSpecialized<5387, T>(a);
   case 710:
-    return RadicalInverseSpecialized<5393>(a);
+    return RadicalInverseSpecialized<5393, T>(a);
   case 711:
-    return RadicalInverseSpecialized<5399>(a);
+    return RadicalInverseSpecialized<5399, T>(a);
   case 712:
-    return RadicalInverseSpecialized<5407>(a);
+    return RadicalInverseSpecialized<5407, T>(a);
   case 713:
-    return RadicalInverseSpecialized<5413>(a);
+    return RadicalInverseSpecialized<5413, T>(a);
   case 714:
-    return RadicalInverseSpecialized<5417>(a);
+    return RadicalInverseSpecialized<5417, T>(a);
   case 715:
-    return RadicalInverseSpecialized<5419>(a);
+    return RadicalInverseSpecialized<5419, T>(a);
   case 716:
-    return RadicalInverseSpecialized<5431>(a);
+    return RadicalInverseSpecialized<5431, T>(a);
   case 717:
-    return RadicalInverseSpecialized<5437>(a);
+    return RadicalInverseSpecialized<5437, T>(a);
   case 718:
-    return RadicalInverseSpecialized<5441>(a);
+    return RadicalInverseSpecialized<5441, T>(a);
   case 719:
-    return RadicalInverseSpecialized<5443>(a);
+    return RadicalInverseSpecialized<5443, T>(a);
   case 720:
-    return RadicalInverseSpecialized<5449>(a);
+    return RadicalInverseSpecialized<5449, T>(a);
   case 721:
-    return RadicalInverseSpecialized<5471>(a);
+    return RadicalInverseSpecialized<5471, T>(a);
   case 722:
-    return RadicalInverseSpecialized<5477>(a);
+    return RadicalInverseSpecialized<5477, T>(a);
   case 723:
-    return RadicalInverseSpecialized<5479>(a);
+    return RadicalInverseSpecialized<5479, T>(a);
   case 724:
-    return RadicalInverseSpecialized<5483>(a);
+    return RadicalInverseSpecialized<5483, T>(a);
   case 725:
-    return RadicalInverseSpecialized<5501>(a);
+    return RadicalInverseSpecialized<5501, T>(a);
   case 726:
-    return RadicalInverseSpecialized<5503>(a);
+    return RadicalInverseSpecialized<5503, T>(a);
   case 727:
-    return RadicalInverseSpecialized<5507>(a);
+    return RadicalInverseSpecialized<5507, T>(a);
   case 728:
-    return RadicalInverseSpecialized<5519>(a);
+    return RadicalInverseSpecialized<5519, T>(a);
   case 729:
-    return RadicalInverseSpecialized<5521>(a);
+    return RadicalInverseSpecialized<5521, T>(a);
   case 730:
-    return RadicalInverseSpecialized<5527>(a);
+    return RadicalInverseSpecialized<5527, T>(a);
   case 731:
-    return RadicalInverseSpecialized<5531>(a);
+    return RadicalInverseSpecialized<5531, T>(a);
   case 732:
-    return RadicalInverseSpecialized<5557>(a);
+    return RadicalInverseSpecialized<5557, T>(a);
   case 733:
-    return RadicalInverseSpecialized<5563>(a);
+    return RadicalInverseSpecialized<5563, T>(a);
   case 734:
-    return RadicalInverseSpecialized<5569>(a);
+    return RadicalInverseSpecialized<5569, T>(a);
   case 735:
-    return RadicalInverseSpecialized<5573>(a);
+    return RadicalInverseSpecialized<5573, T>(a);
   case 736:
-    return RadicalInverseSpecialized<5581>(a);
+    return RadicalInverseSpecialized<5581, T>(a);
   case 737:
-    return RadicalInverseSpecialized<5591>(a);
+    return RadicalInverseSpecialized<5591, T>(a);
   case 738:
-    return RadicalInverseSpecialized<5623>(a);
+    return RadicalInverseSpecialized<5623, T>(a);
   case 739:
-    return RadicalInverseSpecialized<5639>(a);
+    return RadicalInverseSpecialized<5639, T>(a);
   case 740:
-    return RadicalInverseSpecialized<5641>(a);
+    return RadicalInverseSpecialized<5641, T>(a);
   case 741:
-    return RadicalInverseSpecialized<5647>(a);
+    return RadicalInverseSpecialized<5647, T>(a);
   case 742:
-    return RadicalInverseSpecialized<5651>(a);
+    return RadicalInverseSpecialized<5651, T>(a);
   case 743:
-    return RadicalInverseSpecialized<5653>(a);
+    return RadicalInverseSpecialized<5653, T>(a);
   case 744:
-    return RadicalInverseSpecialized<5657>(a);
+    return RadicalInverseSpecialized<5657, T>(a);
   case 745:
-    return RadicalInverseSpecialized<5659>(a);
+    return RadicalInverseSpecialized<5659, T>(a);
   case 746:
-    return RadicalInverseSpecialized<5669>(a);
+    return RadicalInverseSpecialized<5669, T>(a);
   case 747:
-    return RadicalInverseSpecialized<5683>(a);
+    return RadicalInverseSpecialized<5683, T>(a);
   case 748:
-    return RadicalInverseSpecialized<5689>(a);
+    return RadicalInverseSpecialized<5689, T>(a);
   case 749:
-    return RadicalInverseSpecialized<5693>(a);
+    return RadicalInverseSpecialized<5693, T>(a);
   case 750:
-    return RadicalInverseSpecialized<5701>(a);
+    return RadicalInverseSpecialized<5701, T>(a);
   case 751:
-    return RadicalInverseSpecialized<5711>(a);
+    return RadicalInverseSpecialized<5711, T>(a);
   case 752:
-    return RadicalInverseSpecialized<5717>(a);
+    return RadicalInverseSpecialized<5717, T>(a);
   case 753:
-    return RadicalInverseSpecialized<5737>(a);
+    return RadicalInverseSpecialized<5737, T>(a);
   case 754:
-    return RadicalInverseSpecialized<5741>(a);
+    return RadicalInverseSpecialized<5741, T>(a);
   case 755:
-    return RadicalInverseSpecialized<5743>(a);
+    return RadicalInverseSpecialized<5743, T>(a);
   case 756:
-    return RadicalInverseSpecialized<5749>(a);
+    return RadicalInverseSpecialized<5749, T>(a);
   case 757:
-    return RadicalInverseSpecialized<5779>(a);
+    return RadicalInverseSpecialized<5779, T>(a);
   case 758:
-    return RadicalInverseSpecialized<5783>(a);
+    return RadicalInverseSpecialized<5783, T>(a);
   case 759:
-    return RadicalInverseSpecialized<5791>(a);
+    return RadicalInverseSpecialized<5791, T>(a);
   case 760:
-    return RadicalInverseSpecialized<5801>(a);
+    return RadicalInverseSpecialized<5801, T>(a);
   case 761:
-    return RadicalInverseSpecialized<5807>(a);
+    return RadicalInverseSpecialized<5807, T>(a);
   case 762:
-    return RadicalInverseSpecialized<5813>(a);
+    return RadicalInverseSpecialized<5813, T>(a);
   case 763:
-    return RadicalInverseSpecialized<5821>(a);
+    return RadicalInverseSpecialized<5821, T>(a);
   case 764:
-    return RadicalInverseSpecialized<5827>(a);
+    return RadicalInverseSpecialized<5827, T>(a);
   case 765:
-    return RadicalInverseSpecialized<5839>(a);
+    return RadicalInverseSpecialized<5839, T>(a);
   case 766:
-    return RadicalInverseSpecialized<5843>(a);
+    return RadicalInverseSpecialized<5843, T>(a);
   case 767:
-    return RadicalInverseSpecialized<5849>(a);
+    return RadicalInverseSpecialized<5849, T>(a);
   case 768:
-    return RadicalInverseSpecialized<5851>(a);
+    return RadicalInverseSpecialized<5851, T>(a);
   case 769:
-    return RadicalInverseSpecialized<5857>(a);
+    return RadicalInverseSpecialized<5857, T>(a);
   case 770:
-    return RadicalInverseSpecialized<5861>(a);
+    return RadicalInverseSpecialized<5861, T>(a);
   case 771:
-    return RadicalInverseSpecialized<5867>(a);
+    return RadicalInverseSpecialized<5867, T>(a);
   case 772:
-    return RadicalInverseSpecialized<5869>(a);
+    return RadicalInverseSpecialized<5869, T>(a);
   case 773:
-    return RadicalInverseSpecialized<5879>(a);
+    return RadicalInverseSpecialized<5879, T>(a);
   case 774:
-    return RadicalInverseSpecialized<5881>(a);
+    return RadicalInverseSpecialized<5881, T>(a);
   case 775:
-    return RadicalInverseSpecialized<5897>(a);
+    return RadicalInverseSpecialized<5897, T>(a);
   case 776:
-    return RadicalInverseSpecialized<5903>(a);
+    return RadicalInverseSpecialized<5903, T>(a);
   case 777:
-    return RadicalInverseSpecialized<5923>(a);
+    return RadicalInverseSpecialized<5923, T>(a);
   case 778:
-    return RadicalInverseSpecialized<5927>(a);
+    return RadicalInverseSpecialized<5927, T>(a);
   case 779:
-    return RadicalInverseSpecialized<5939>(a);
+    return RadicalInverseSpecialized<5939, T>(a);
   case 780:
-    return RadicalInverseSpecialized<5953>(a);
+    return RadicalInverseSpecialized<5953, T>(a);
   case 781:
-    return RadicalInverseSpecialized<5981>(a);
+    return RadicalInverseSpecialized<5981, T>(a);
   case 782:
-    return RadicalInverseSpecialized<5987>(a);
+    return RadicalInverseSpecialized<5987, T>(a);
   case 783:
-    return RadicalInverseSpecialized<6007>(a);
+    return RadicalInverseSpecialized<6007, T>(a);
   case 784:
-    return RadicalInverseSpecialized<6011>(a);
+    return RadicalInverseSpecialized<6011, T>(a);
   case 785:
-    return RadicalInverseSpecialized<6029>(a);
+    return RadicalInverseSpecialized<6029, T>(a);
   case 786:
-    return RadicalInverseSpecialized<6037>(a);
+    return RadicalInverseSpecialized<6037, T>(a);
   case 787:
-    return RadicalInverseSpecialized<6043>(a);
+    return RadicalInverseSpecialized<6043, T>(a);
   case 788:
-    return RadicalInverseSpecialized<6047>(a);
+    return RadicalInverseSpecialized<6047, T>(a);
   case 789:
-    return RadicalInverseSpecialized<6053>(a);
+    return RadicalInverseSpecialized<6053, T>(a);
   case 790:
-    return RadicalInverseSpecialized<6067>(a);
+    return RadicalInverseSpecialized<6067, T>(a);
   case 791:
-    return RadicalInverseSpecialized<6073>(a);
+    return RadicalInverseSpecialized<6073, T>(a);
   case 792:
-    return RadicalInverseSpecialized<6079>(a);
+    return RadicalInverseSpecialized<6079, T>(a);
   case 793:
-    return RadicalInverseSpecialized<6089>(a);
+    return RadicalInverseSpecialized<6089, T>(a);
   case 794:
-    return RadicalInverseSpecialized<6091>(a);
+    return RadicalInverseSpecialized<6091, T>(a);
   case 795:
-    return RadicalInverseSpecialized<6101>(a);
+    return RadicalInverseSpecialized<6101, T>(a);
   case 796:
-    return RadicalInverseSpecialized<6113>(a);
+    return RadicalInverseSpecialized<6113, T>(a);
   case 797:
-    return RadicalInverseSpecialized<6121>(a);
+    return RadicalInverseSpecialized<6121, T>(a);
   case 798:
-    return RadicalInverseSpecialized<6131>(a);
+    return RadicalInverseSpecialized<6131, T>(a);
   case 799:
-    return RadicalInverseSpecialized<6133>(a);
+    return RadicalInverseSpecialized<6133, T>(a);
   case 800:
-    return RadicalInverseSpecialized<6143>(a);
+    return RadicalInverseSpecialized<6143, T>(a);
   case 801:
-    return RadicalInverseSpecialized<6151>(a);
+    return RadicalInverseSpecialized<6151, T>(a);
   case 802:
-    return RadicalInverseSpecialized<6163>(a);
+    return RadicalInverseSpecialized<6163, T>(a);
   case 803:
-    return RadicalInverseSpecialized<6173>(a);
+    return RadicalInverseSpecialized<6173, T>(a);
   case 804:
-    return RadicalInverseSpecialized<6197>(a);
+    return RadicalInverseSpecialized<6197, T>(a);
   case 805:
-    return RadicalInverseSpecialized<6199>(a);
+    return RadicalInverseSpecialized<6199, T>(a);
   case 806:
-    return RadicalInverseSpecialized<6203>(a);
+    return RadicalInverseSpecialized<6203, T>(a);
   case 807:
-    return RadicalInverseSpecialized<6211>(a);
+    return RadicalInverseSpecialized<6211, T>(a);
   case 808:
-    return RadicalInverseSpecialized<6217>(a);
+    return RadicalInverseSpecialized<6217, T>(a);
   case 809:
-    return RadicalInverseSpecialized<6221>(a);
+    return RadicalInverseSpecialized<6221, T>(a);
   case 810:
-    return RadicalInverseSpecialized<6229>(a);
+    return RadicalInverseSpecialized<6229, T>(a);
   case 811:
-    return RadicalInverseSpecialized<6247>(a);
+    return RadicalInverseSpecialized<6247, T>(a);
   case 812:
-    return RadicalInverseSpecialized<6257>(a);
+    return RadicalInverseSpecialized<6257, T>(a);
   case 813:
-    return RadicalInverseSpecialized<6263>(a);
+    return RadicalInverseSpecialized<6263, T>(a);
   case 814:
-    return RadicalInverseSpecialized<6269>(a);
+    return RadicalInverseSpecialized<6269, T>(a);
   case 815:
-    return RadicalInverseSpecialized<6271>(a);
+    return RadicalInverseSpecialized<6271, T>(a);
   case 816:
-    return RadicalInverseSpecialized<6277>(a);
+    return RadicalInverseSpecialized<6277, T>(a);
   case 817:
-    return RadicalInverseSpecialized<6287>(a);
+    return RadicalInverseSpecialized<6287, T>(a);
   case 818:
-    return RadicalInverseSpecialized<6299>(a);
+    return RadicalInverseSpecialized<6299, T>(a);
   case 819:
-    return RadicalInverseSpecialized<6301>(a);
+    return RadicalInverseSpecialized<6301, T>(a);
   case 820:
-    return RadicalInverseSpecialized<6311>(a);
+    return RadicalInverseSpecialized<6311, T>(a);
   case 821:
-    return RadicalInverseSpecialized<6317>(a);
+    return RadicalInverseSpecialized<6317, T>(a);
   case 822:
-    return RadicalInverseSpecialized<6323>(a);
+    return RadicalInverseSpecialized<6323, T>(a);
   case 823:
-    return RadicalInverseSpecialized<6329>(a);
+    return RadicalInverseSpecialized<6329, T>(a);
   case 824:
-    return RadicalInverseSpecialized<6337>(a);
+    return RadicalInverseSpecialized<6337, T>(a);
   case 825:
-    return RadicalInverseSpecialized<6343>(a);
+    return RadicalInverseSpecialized<6343, T>(a);
   case 826:
-    return RadicalInverseSpecialized<6353>(a);
+    return RadicalInverseSpecialized<6353, T>(a);
   case 827:
-    return RadicalInverseSpecialized<6359>(a);
+    return RadicalInverseSpecialized<6359, T>(a);
   case 828:
-    return RadicalInverseSpecialized<6361>(a);
+    return RadicalInverseSpecialized<6361, T>(a);
   case 829:
-    return RadicalInverseSpecialized<6367>(a);
+    return RadicalInverseSpecialized<6367, T>(a);
   case 830:
-    return RadicalInverseSpecialized<6373>(a);
+    return RadicalInverseSpecialized<6373, T>(a);
   case 831:
-    return RadicalInverseSpecialized<6379>(a);
+    return RadicalInverseSpecialized<6379, T>(a);
   case 832:
-    return RadicalInverseSpecialized<6389>(a);
+    return RadicalInverseSpecialized<6389, T>(a);
   case 833:
-    return RadicalInverseSpecialized<6397>(a);
+    return RadicalInverseSpecialized<6397, T>(a);
   case 834:
-    return RadicalInverseSpecialized<6421>(a);
+    return RadicalInverseSpecialized<6421, T>(a);
   case 835:
-    return RadicalInverseSpecialized<6427>(a);
+    return RadicalInverseSpecialized<6427, T>(a);
   case 836:
-    return RadicalInverseSpecialized<6449>(a);
+    return RadicalInverseSpecialized<6449, T>(a);
   case 837:
-    return RadicalInverseSpecialized<6451>(a);
+    return RadicalInverseSpecialized<6451, T>(a);
   case 838:
-    return RadicalInverseSpecialized<6469>(a);
+    return RadicalInverseSpecialized<6469, T>(a);
   case 839:
-    return RadicalInverseSpecialized<6473>(a);
+    return RadicalInverseSpecialized<6473, T>(a);
   case 840:
-    return RadicalInverseSpecialized<6481>(a);
+    return RadicalInverseSpecialized<6481, T>(a);
   case 841:
-    return RadicalInverseSpecialized<6491>(a);
+    return RadicalInverseSpecialized<6491, T>(a);
   case 842:
-    return RadicalInverseSpecialized<6521>(a);
+    return RadicalInverseSpecialized<6521, T>(a);
   case 843:
-    return RadicalInverseSpecialized<6529>(a);
+    return RadicalInverseSpecialized<6529, T>(a);
   case 844:
-    return RadicalInverseSpecialized<6547>(a);
+    return RadicalInverseSpecialized<6547, T>(a);
   case 845:
-    return RadicalInverseSpecialized<6551>(a);
+    return RadicalInverseSpecialized<6551, T>(a);
   case 846:
-    return RadicalInverseSpecialized<6553>(a);
+    return RadicalInverseSpecialized<6553, T>(a);
   case 847:
-    return RadicalInverseSpecialized<6563>(a);
+    return RadicalInverseSpecialized<6563, T>(a);
   case 848:
-    return RadicalInverseSpecialized<6569>(a);
+    return RadicalInverseSpecialized<6569, T>(a);
   case 849:
-    return RadicalInverseSpecialized<6571>(a);
+    return RadicalInverseSpecialized<6571, T>(a);
   case 850:
-    return RadicalInverseSpecialized<6577>(a);
+    return RadicalInverseSpecialized<6577, T>(a);
   case 851:
-    return RadicalInverseSpecialized<6581>(a);
+    return RadicalInverseSpecialized<6581, T>(a);
   case 852:
-    return RadicalInverseSpecialized<6599>(a);
+    return RadicalInverseSpecialized<6599, T>(a);
   case 853:
-    return RadicalInverseSpecialized<6607>(a);
+    return RadicalInverseSpecialized<6607, T>(a);
   case 854:
-    return RadicalInverseSpecialized<6619>(a);
+    return RadicalInverseSpecialized<6619, T>(a);
   case 855:
-    return RadicalInverseSpecialized<6637>(a);
+    return RadicalInverseSpecialized<6637, T>(a);
   case 856:
-    return RadicalInverseSpecialized<6653>(a);
+    return RadicalInverseSpecialized<6653, T>(a);
   case 857:
-    return RadicalInverseSpecialized<6659>(a);
+    return RadicalInverseSpecialized<6659, T>(a);
   case 858:
-    return RadicalInverseSpecialized<6661>(a);
+    return RadicalInverseSpecialized<6661, T>(a);
   case 859:
-    return RadicalInverseSpecialized<6673>(a);
+    return RadicalInverseSpecialized<6673, T>(a);
   case 860:
-    return RadicalInverseSpecialized<6679>(a);
+    return RadicalInverseSpecialized<6679, T>(a);
   case 861:
-    return RadicalInverseSpecialized<6689>(a);
+    return RadicalInverseSpecialized<6689, T>(a);
   case 862:
-    return RadicalInverseSpecialized<6691>(a);
+    return RadicalInverseSpecialized<6691, T>(a);
   case 863:
-    return RadicalInverseSpecialized<6701>(a);
+    return RadicalInverseSpecialized<6701, T>(a);
   case 864:
-    return RadicalInverseSpecialized<6703>(a);
+    return RadicalInverseSpecialized<6703, T>(a);
   case 865:
-    return RadicalInverseSpecialized<6709>(a);
+    return RadicalInverseSpecialized<6709, T>(a);
   case 866:
-    return RadicalInverseSpecialized<6719>(a);
+    return RadicalInverseSpecialized<6719, T>(a);
   case 867:
-    return RadicalInverseSpecialized<6733>(a);
+    return RadicalInverseSpecialized<6733, T>(a);
   case 868:
-    return RadicalInverseSpecialized<6737>(a);
+    return RadicalInverseSpecialized<6737, T>(a);
   case 869:
-    return RadicalInverseSpecialized<6761>(a);
+    return RadicalInverseSpecialized<6761, T>(a);
   case 870:
-    return RadicalInverseSpecialized<6763>(a);
+    return RadicalInverseSpecialized<6763, T>(a);
   case 871:
-    return RadicalInverseSpecialized<6779>(a);
+    return RadicalInverseSpecialized<6779, T>(a);
   case 872:
-    return RadicalInverseSpecialized<6781>(a);
+    return RadicalInverseSpecialized<6781, T>(a);
   case 873:
-    return RadicalInverseSpecialized<6791>(a);
+    return RadicalInverseSpecialized<6791, T>(a);
   case 874:
-    return RadicalInverseSpecialized<6793>(a);
+    return RadicalInverseSpecialized<6793, T>(a);
   case 875:
-    return RadicalInverseSpecialized<6803>(a);
+    return RadicalInverseSpecialized<6803, T>(a);
   case 876:
-    return RadicalInverseSpecialized<6823>(a);
+    return RadicalInverseSpecialized<6823, T>(a);
   case 877:
-    return RadicalInverseSpecialized<6827>(a);
+    return RadicalInverseSpecialized<6827, T>(a);
   case 878:
-    return RadicalInverseSpecialized<6829>(a);
+    return RadicalInverseSpecialized<6829, T>(a);
   case 879:
-    return RadicalInverseSpecialized<6833>(a);
+    return RadicalInverseSpecialized<6833, T>(a);
   case 880:
-    return RadicalInverseSpecialized<6841>(a);
+    return RadicalInverseSpecialized<6841, T>(a);
   case 881:
-    return RadicalInverseSpecialized<6857>(a);
+    return RadicalInverseSpecialized<6857, T>(a);
   case 882:
-    return RadicalInverseSpecialized<6863>(a);
+    return RadicalInverseSpecialized<6863, T>(a);
   case 883:
-    return RadicalInverseSpecialized<6869>(a);
+    return RadicalInverseSpecialized<6869, T>(a);
   case 884:
-    return RadicalInverseSpecialized<6871>(a);
+    return RadicalInverseSpecialized<6871, T>(a);
   case 885:
-    return RadicalInverseSpecialized<6883>(a);
+    return RadicalInverseSpecialized<6883, T>(a);
   case 886:
-    return RadicalInverseSpecialized<6899>(a);
+    return RadicalInverseSpecialized<6899, T>(a);
   case 887:
-    return RadicalInverseSpecialized<6907>(a);
+    return RadicalInverseSpecialized<6907, T>(a);
   case 888:
-    return RadicalInverseSpecialized<6911>(a);
+    return RadicalInverseSpecialized<6911, T>(a);
   case 889:
-    return RadicalInverseSpecialized<6917>(a);
+    return RadicalInverseSpecialized<6917, T>(a);
   case 890:
-    return RadicalInverseSpecialized<6947>(a);
+    return RadicalInverseSpecialized<6947, T>(a);
   case 891:
-    return RadicalInverseSpecialized<6949>(a);
+    return RadicalInverseSpecialized<6949, T>(a);
   case 892:
-    return RadicalInverseSpecialized<6959>(a);
+    return RadicalInverseSpecialized<6959, T>(a);
   case 893:
-    return RadicalInverseSpecialized<6961>(a);
+    return RadicalInverseSpecialized<6961, T>(a);
   case 894:
-    return RadicalInverseSpecialized<6967>(a);
+    return RadicalInverseSpecialized<6967, T>(a);
   case 895:
-    return RadicalInverseSpecialized<6971>(a);
+    return RadicalInverseSpecialized<6971, T>(a);
   case 896:
-    return RadicalInverseSpecialized<6977>(a);
+    return RadicalInverseSpecialized<6977, T>(a);
   case 897:
-    return RadicalInverseSpecialized<6983>(a);
+    return RadicalInverseSpecialized<6983, T>(a);
   case 898:
-    return RadicalInverseSpecialized<6991>(a);
+    return RadicalInverseSpecialized<6991, T>(a);
   case 899:
-    return RadicalInverseSpecialized<6997>(a);
+    return RadicalInverseSpecialized<6997, T>(a);
   case 900:
-    return RadicalInverseSpecialized<7001>(a);
+    return RadicalInverseSpecialized<7001, T>(a);
   case 901:
-    return RadicalInverseSpecialized<7013>(a);
+    return RadicalInverseSpecialized<7013, T>(a);
   case 902:
-    return RadicalInverseSpecialized<7019>(a);
+    return RadicalInverseSpecialized<7019, T>(a);
   case 903:
-    return RadicalInverseSpecialized<7027>(a);
+    return RadicalInverseSpecialized<7027, T>(a);
   case 904:
-    return RadicalInverseSpecialized<7039>(a);
+    return RadicalInverseSpecialized<7039, T>(a);
   case 905:
-    return RadicalInverseSpecialized<7043>(a);
+    return RadicalInverseSpecialized<7043, T>(a);
   case 906:
-    return RadicalInverseSpecialized<7057>(a);
+    return RadicalInverseSpecialized<7057, T>(a);
   case 907:
-    return RadicalInverseSpecialized<7069>(a);
+    return RadicalInverseSpecialized<7069, T>(a);
   case 908:
-    return RadicalInverseSpecialized<7079>(a);
+    return RadicalInverseSpecialized<7079, T>(a);
   case 909:
-    return RadicalInverseSpecialized<7103>(a);
+    return RadicalInverseSpecialized<7103, T>(a);
   case 910:
-    return RadicalInverseSpecialized<7109>(a);
+    return RadicalInverseSpecialized<7109, T>(a);
   case 911:
-    return RadicalInverseSpecialized<7121>(a);
+    return RadicalInverseSpecialized<7121, T>(a);
   case 912:
-    return RadicalInverseSpecialized<7127>(a);
+    return RadicalInverseSpecialized<7127, T>(a);
   case 913:
-    return RadicalInverseSpecialized<7129>(a);
+    return RadicalInverseSpecialized<7129, T>(a);
   case 914:
-    return RadicalInverseSpecialized<7151>(a);
+    return RadicalInverseSpecialized<7151, T>(a);
   case 915:
-    return RadicalInverseSpecialized<7159>(a);
+    return RadicalInverseSpecialized<7159, T>(a);
   case 916:
-    return RadicalInverseSpecialized<7177>(a);
+    return RadicalInverseSpecialized<7177, T>(a);
   case 917:
-    return RadicalInverseSpecialized<7187>(a);
+    return RadicalInverseSpecialized<7187, T>(a);
   case 918:
-    return RadicalInverseSpecialized<7193>(a);
+    return RadicalInverseSpecialized<7193, T>(a);
   case 919:
-    return RadicalInverseSpecialized<7207>(a);
+    return RadicalInverseSpecialized<7207, T>(a);
   case 920:
-    return RadicalInverseSpecialized<7211>(a);
+    return RadicalInverseSpecialized<7211, T>(a);
   case 921:
-    return RadicalInverseSpecialized<7213>(a);
+    return RadicalInverseSpecialized<7213, T>(a);
   case 922:
-    return RadicalInverseSpecialized<7219>(a);
+    return RadicalInverseSpecialized<7219, T>(a);
   case 923:
-    return RadicalInverseSpecialized<7229>(a);
+    return RadicalInverseSpecialized<7229, T>(a);
   case 924:
-    return RadicalInverseSpecialized<7237>(a);
+    return RadicalInverseSpecialized<7237, T>(a);
   case 925:
-    return RadicalInverseSpecialized<7243>(a);
+    return RadicalInverseSpecialized<7243, T>(a);
   case 926:
-    return RadicalInverseSpecialized<7247>(a);
+    return RadicalInverseSpecialized<7247, T>(a);
   case 927:
-    return RadicalInverseSpecialized<7253>(a);
+    return RadicalInverseSpecialized<7253, T>(a);
   case 928:
-    return RadicalInverseSpecialized<7283>(a);
+    return RadicalInverseSpecialized<7283, T>(a);
   case 929:
-    return RadicalInverseSpecialized<7297>(a);
+    return RadicalInverseSpecialized<7297, T>(a);
   case 930:
-    return RadicalInverseSpecialized<7307>(a);
+    return RadicalInverseSpecialized<7307, T>(a);
   case 931:
-    return RadicalInverseSpecialized<7309>(a);
+    return RadicalInverseSpecialized<7309, T>(a);
   case 932:
-    return RadicalInverseSpecialized<7321>(a);
+    return RadicalInverseSpecialized<7321, T>(a);
   case 933:
-    return RadicalInverseSpecialized<7331>(a);
+    return RadicalInverseSpecialized<7331, T>(a);
   case 934:
-    return RadicalInverseSpecialized<7333>(a);
+    return RadicalInverseSpecialized<7333, T>(a);
   case 935:
-    return RadicalInverseSpecialized<7349>(a);
+    return RadicalInverseSpecialized<7349, T>(a);
   case 936:
-    return RadicalInverseSpecialized<7351>(a);
+    return RadicalInverseSpecialized<7351, T>(a);
   case 937:
-    return RadicalInverseSpecialized<7369>(a);
+    return RadicalInverseSpecialized<7369, T>(a);
   case 938:
-    return RadicalInverseSpecialized<7393>(a);
+    return RadicalInverseSpecialized<7393, T>(a);
   case 939:
-    return RadicalInverseSpecialized<7411>(a);
+    return RadicalInverseSpecialized<7411, T>(a);
   case 940:
-    return RadicalInverseSpecialized<7417>(a);
+    return RadicalInverseSpecialized<7417, T>(a);
   case 941:
-    return RadicalInverseSpecialized<7433>(a);
+    return RadicalInverseSpecialized<7433, T>(a);
   case 942:
-    return RadicalInverseSpecialized<7451>(a);
+    return RadicalInverseSpecialized<7451, T>(a);
   case 943:
-    return RadicalInverseSpecialized<7457>(a);
+    return RadicalInverseSpecialized<7457, T>(a);
   case 944:
-    return RadicalInverseSpecialized<7459>(a);
+    return RadicalInverseSpecialized<7459, T>(a);
   case 945:
-    return RadicalInverseSpecialized<7477>(a);
+    return RadicalInverseSpecialized<7477, T>(a);
   case 946:
-    return RadicalInverseSpecialized<7481>(a);
+    return RadicalInverseSpecialized<7481, T>(a);
   case 947:
-    return RadicalInverseSpecialized<7487>(a);
+    return RadicalInverseSpecialized<7487, T>(a);
   case 948:
-    return RadicalInverseSpecialized<7489>(a);
+    return RadicalInverseSpecialized<7489, T>(a);
   case 949:
-    return RadicalInverseSpecialized<7499>(a);
+    return RadicalInverseSpecialized<7499, T>(a);
   case 950:
-    return RadicalInverseSpecialized<7507>(a);
+    return RadicalInverseSpecialized<7507, T>(a);
   case 951:
-    return RadicalInverseSpecialized<7517>(a);
+    return RadicalInverseSpecialized<7517, T>(a);
   case 952:
-    return RadicalInverseSpecialized<7523>(a);
+    return RadicalInverseSpecialized<7523, T>(a);
   case 953:
-    return RadicalInverseSpecialized<7529>(a);
+    return RadicalInverseSpecialized<7529, T>(a);
   case 954:
-    return RadicalInverseSpecialized<7537>(a);
+    return RadicalInverseSpecialized<7537, T>(a);
   case 955:
-    return RadicalInverseSpecialized<7541>(a);
+    return RadicalInverseSpecialized<7541, T>(a);
   case 956:
-    return RadicalInverseSpecialized<7547>(a);
+    return RadicalInverseSpecialized<7547, T>(a);
   case 957:
-    return RadicalInverseSpecialized<7549>(a);
+    return RadicalInverseSpecialized<7549, T>(a);
   case 958:
-    return RadicalInverseSpecialized<7559>(a);
+    return RadicalInverseSpecialized<7559, T>(a);
   case 959:
-    return RadicalInverseSpecialized<7561>(a);
+    return RadicalInverseSpecialized<7561, T>(a);
   case 960:
-    return RadicalInverseSpecialized<7573>(a);
+    return RadicalInverseSpecialized<7573, T>(a);
   case 961:
-    return RadicalInverseSpecialized<7577>(a);
+    return RadicalInverseSpecialized<7577, T>(a);
   case 962:
-    return RadicalInverseSpecialized<7583>(a);
+    return RadicalInverseSpecialized<7583, T>(a);
   case 963:
-    return RadicalInverseSpecialized<7589>(a);
+    return RadicalInverseSpecialized<7589, T>(a);
   case 964:
-    return RadicalInverseSpecialized<7591>(a);
+    return RadicalInverseSpecialized<7591, T>(a);
   case 965:
-    return RadicalInverseSpecialized<7603>(a);
+    return RadicalInverseSpecialized<7603, T>(a);
   case 966:
-    return RadicalInverseSpecialized<7607>(a);
+    return RadicalInverseSpecialized<7607, T>(a);
   case 967:
-    return RadicalInverseSpecialized<7621>(a);
+    return RadicalInverseSpecialized<7621, T>(a);
   case 968:
-    return RadicalInverseSpecialized<7639>(a);
+    return RadicalInverseSpecialized<7639, T>(a);
   case 969:
-    return RadicalInverseSpecialized<7643>(a);
+    return RadicalInverseSpecialized<7643, T>(a);
   case 970:
-    return RadicalInverseSpecialized<7649>(a);
+    return RadicalInverseSpecialized<7649, T>(a);
   case 971:
-    return RadicalInverseSpecialized<7669>(a);
+    return RadicalInverseSpecialized<7669, T>(a);
   case 972:
-    return RadicalInverseSpecialized<7673>(a);
+    return RadicalInverseSpecialized<7673, T>(a);
   case 973:
-    return RadicalInverseSpecialized<7681>(a);
+    return RadicalInverseSpecialized<7681, T>(a);
   case 974:
-    return RadicalInverseSpecialized<7687>(a);
+    return RadicalInverseSpecialized<7687, T>(a);
   case 975:
-    return RadicalInverseSpecialized<7691>(a);
+    return RadicalInverseSpecialized<7691, T>(a);
   case 976:
-    return RadicalInverseSpecialized<7699>(a);
+    return RadicalInverseSpecialized<7699, T>(a);
   case 977:
-    return RadicalInverseSpecialized<7703>(a);
+    return RadicalInverseSpecialized<7703, T>(a);
   case 978:
-    return RadicalInverseSpecialized<7717>(a);
+    return RadicalInverseSpecialized<7717, T>(a);
   case 979:
-    return RadicalInverseSpecialized<7723>(a);
+    return RadicalInverseSpecialized<7723, T>(a);
   case 980:
-    return RadicalInverseSpecialized<7727>(a);
+    return RadicalInverseSpecialized<7727, T>(a);
   case 981:
-    return RadicalInverseSpecialized<7741>(a);
+    return RadicalInverseSpecialized<7741, T>(a);
   case 982:
-    return RadicalInverseSpecialized<7753>(a);
+    return RadicalInverseSpecialized<7753, T>(a);
   case 983:
-    return RadicalInverseSpecialized<7757>(a);
+    return RadicalInverseSpecialized<7757, T>(a);
   case 984:
-    return RadicalInverseSpecialized<7759>(a);
+    return RadicalInverseSpecialized<7759, T>(a);
   case 985:
-    return RadicalInverseSpecialized<7789>(a);
+    return RadicalInverseSpecialized<7789, T>(a);
   case 986:
-    return RadicalInverseSpecialized<7793>(a);
+    return RadicalInverseSpecialized<7793, T>(a);
   case 987:
-    return RadicalInverseSpecialized<7817>(a);
+    return RadicalInverseSpecialized<7817, T>(a);
   case 988:
-    return RadicalInverseSpecialized<7823>(a);
+    return RadicalInverseSpecialized<7823, T>(a);
   case 989:
-    return RadicalInverseSpecialized<7829>(a);
+    return RadicalInverseSpecialized<7829, T>(a);
   case 990:
-    return RadicalInverseSpecialized<7841>(a);
+    return RadicalInverseSpecialized<7841, T>(a);
   case 991:
-    return RadicalInverseSpecialized<7853>(a);
+    return RadicalInverseSpecialized<7853, T>(a);
   case 992:
-    return RadicalInverseSpecialized<7867>(a);
+    return RadicalInverseSpecialized<7867, T>(a);
   case 993:
-    return RadicalInverseSpecialized<7873>(a);
+    return RadicalInverseSpecialized<7873, T>(a);
   case 994:
-    return RadicalInverseSpecialized<7877>(a);
+    return RadicalInverseSpecialized<7877, T>(a);
   case 995:
-    return RadicalInverseSpecialized<7879>(a);
+    return RadicalInverseSpecialized<7879, T>(a);
   case 996:
-    return RadicalInverseSpecialized<7883>(a);
+    return RadicalInverseSpecialized<7883, T>(a);
   case 997:
-    return RadicalInverseSpecialized<7901>(a);
+    return RadicalInverseSpecialized<7901, T>(a);
   case 998:
-    return RadicalInverseSpecialized<7907>(a);
+    return RadicalInverseSpecialized<7907, T>(a);
   case 999:
-    return RadicalInverseSpecialized<7919>(a);
+    return RadicalInverseSpecialized<7919, T>(a);
   case 1000:
-    return RadicalInverseSpecialized<7927>(a);
+    return RadicalInverseSpecialized<7927, T>(a);
   case 1001:
-    return RadicalInverseSpecialized<7933>(a);
+    return RadicalInverseSpecialized<7933, T>(a);
   case 1002:
-    return RadicalInverseSpecialized<7937>(a);
+    return RadicalInverseSpecialized<7937, T>(a);
   case 1003:
-    return RadicalInverseSpecialized<7949>(a);
+    return RadicalInverseSpecialized<7949, T>(a);
   case 1004:
-    return RadicalInverseSpecialized<7951>(a);
+    return RadicalInverseSpecialized<7951, T>(a);
   case 1005:
-    return RadicalInverseSpecialized<7963>(a);
+    return RadicalInverseSpecialized<7963, T>(a);
   case 1006:
-    return RadicalInverseSpecialized<7993>(a);
+    return RadicalInverseSpecialized<7993, T>(a);
   case 1007:
-    return RadicalInverseSpecialized<8009>(a);
+    return RadicalInverseSpecialized<8009, T>(a);
   case 1008:
-    return RadicalInverseSpecialized<8011>(a);
+    return RadicalInverseSpecialized<8011, T>(a);
   case 1009:
-    return RadicalInverseSpecialized<8017>(a);
+    return RadicalInverseSpecialized<8017, T>(a);
   case 1010:
-    return RadicalInverseSpecialized<8039>(a);
+    return RadicalInverseSpecialized<8039, T>(a);
   case 1011:
-    return RadicalInverseSpecialized<8053>(a);
+    return RadicalInverseSpecialized<8053, T>(a);
   case 1012:
-    return RadicalInverseSpecialized<8059>(a);
+    return RadicalInverseSpecialized<8059, T>(a);
   case 1013:
-    return RadicalInverseSpecialized<8069>(a);
+    return RadicalInverseSpecialized<8069, T>(a);
   case 1014:
-    return RadicalInverseSpecialized<8081>(a);
+    return RadicalInverseSpecialized<8081, T>(a);
   case 1015:
-    return RadicalInverseSpecialized<8087>(a);
+    return RadicalInverseSpecialized<8087, T>(a);
   case 1016:
-    return RadicalInverseSpecialized<8089>(a);
+    return RadicalInverseSpecialized<8089, T>(a);
   case 1017:
-    return RadicalInverseSpecialized<8093>(a);
+    return RadicalInverseSpecialized<8093, T>(a);
   case 1018:
-    return RadicalInverseSpecialized<8101>(a);
+    return RadicalInverseSpecialized<8101, T>(a);
   case 1019:
-    return RadicalInverseSpecialized<8111>(a);
+    return RadicalInverseSpecialized<8111, T>(a);
   case 1020:
-    return RadicalInverseSpecialized<8117>(a);
+    return RadicalInverseSpecialized<8117, T>(a);
   case 1021:
-    return RadicalInverseSpecialized<8123>(a);
+    return RadicalInverseSpecialized<8123, T>(a);
   case 1022:
-    return RadicalInverseSpecialized<8147>(a);
+    return RadicalInverseSpecialized<8147, T>(a);
   case 1023:
-    return RadicalInverseSpecialized<8161>(a);
+    return RadicalInverseSpecialized<8161, T>(a);
   default:
-    Rcpp::Rcout << "Base " << baseIndex << " is >= 1024, the limit of RadicalInverse \n";
-  return 0;
+    throw std::runtime_error("Base index is >= 1024, the limit of RadicalInverse");
+  }
+}
+
+inline Float RadicalInverse(int baseIndex, std::uint64_t a) {
+  return RadicalInverseT<Float>(baseIndex, a);
+}
+
+// Double-precision radical inverse, independent of RAY_FLOAT_AS_DOUBLE.
+inline double RadicalInverseF64(int baseIndex, std::uint64_t a) {
+  if (baseIndex == 0) {
+    // Keep the top 53 bits, so the result can't round up to 1.
+    return (ReverseBits64(a) >> 11) * 0x1p-53;
   }
+  return RadicalInverseT<double>(baseIndex, a);
 }
 }
 
@@ -0,0 +1,144 @@
+#ifndef PARALLELSETSH
+#define PARALLELSETSH
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "sobol.h"
+#include "sobol_simd.h"
+#include "halton_sampler.h"
+#include "halton_batch.h"
+#include "halton_engine.h"
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Multithreaded set generation
+//
+// A set of `n` points in `dims` dimensions is split into tiles of
+// SetTileRows indices by SetTileDims dimensions, small enough that a tile's
+// scratch and output stay in cache. Threads pull tiles off a shared counter;
+// every value depends only on its (index, dimension), so the output is the
+// same for any number of threads. Output is column-major with leading
+// dimension `n`, i.e. the layout of an R matrix.
+
+static const uint64_t SetTileRows = 2048;
+static const uint32_t SetTileDims = 16;
+
+// Calls `fn(row_start, row_count, dim_start, dim_count)` once per tile, spread
+// over `threads` threads (the calling thread is one of them). If `fn` throws,
+// the remaining tiles are skipped and the first exception is rethrown on the
+// calling thread once every thread has finished.
+template<class TileFn>
+static inline void for_each_set_tile(uint64_t n, uint32_t dims, unsigned int threads, TileFn fn) {
+  const uint64_t row_tiles = (n + SetTileRows - 1) / SetTileRows;
+  const uint64_t dim_tiles = (dims + SetTileDims - 1) / SetTileDims;
+  const uint64_t num_tiles = row_tiles * dim_tiles;
+  std::atomic<uint64_t> next_tile(0);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto worker = [&]() {
+    try {
+      for(uint64_t t = next_tile++; t < num_tiles; t = next_tile++) {
+        const uint64_t row_start = (t % row_tiles) * SetTileRows;
+        const uint32_t dim_start = (uint32_t)(t / row_tiles) * SetTileDims;
+        fn(row_start, std::min(SetTileRows, n - row_start),
+           dim_start, std::min(SetTileDims, dims - dim_start));
+      }
+    } catch(...) {
+      // An exception escaping a std::thread would terminate the process.
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if(!error) {
+        error = std::current_exception();
+      }
+      next_tile = num_tiles;
+    }
+  };
+  const uint64_t num_threads = std::min<uint64_t>(std::max(threads, 1u), num_tiles);
+  std::vector<std::thread> pool;
+  for(uint64_t i = 1; i < num_threads; i++) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for(auto& thread : pool) {
+    thread.join();
+  }
+  if(error) {
+    std::rethrow_exception(error);
+  }
+}
+
+// Same values as `sobol_single_f64(i, d, scramble)`.
+static inline void generate_sobol_set(uint64_t n, uint32_t dims, uint32_t scramble,
+                                      double* out, unsigned int threads = 1) {
+  if(dims > (uint32_t)NumSobolDimensions) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  if(n > (uint64_t(1) << 32)) {
+    throw std::runtime_error("Sobol sets have at most 2^32 points");
+  }
+  for_each_set_tile(n, dims, threads,
+    [&](uint64_t row_start, uint64_t row_count, uint32_t dim_start, uint32_t dim_count) {
+      sobol_batch_generator sobol_gen(dim_count, scramble, sobol_order::natural, dim_start);
+      sobol_gen.seek(row_start);
+      sobol_gen.generate(row_count, out + dim_start * n + row_start, n);
+    });
+}
+
+// Same values as `sobol_owen_single_f64(i, d, seed)`.
+static inline void generate_sobol_owen_set(uint64_t n, uint32_t dims, uint32_t seed,
+                                           double* out, unsigned int threads = 1) {
+  if(dims > 21201) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  if(n > (uint64_t(1) << 32)) {
+    throw std::runtime_error("Sobol sets have at most 2^32 points");
+  }
+  for_each_set_tile(n, dims, threads,
+    [&](uint64_t row_start, uint64_t row_count, uint32_t dim_start, uint32_t dim_count) {
+      sobol_owen_block(row_start, row_count, dim_count, seed,
+                       out + dim_start * n + row_start, n, dim_start);
+    });
+}
+
+// Same values as `hs.sample_f64(d, i)`, with the 32-bit index wrapping like
+// sample_f64()'s. `hs` must already be initialized.
+static inline void generate_halton_set(const Halton_sampler& hs, uint64_t n, uint32_t dims,
+                                       double* out, unsigned int threads = 1) {
+  if(dims > Halton_sampler::get_num_dimensions()) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  for_each_set_tile(n, dims, threads,
+    [&](uint64_t row_start, uint64_t row_count, uint32_t dim_start, uint32_t dim_count) {
+      halton_batch_generator halton_gen(hs, dim_count, dim_start);
+      halton_gen.seek((uint32_t)row_start);
+      halton_gen.generate((uint32_t)row_count, out + dim_start * n + row_start, n);
+    });
+}
+
+// Same values as `engine.sample_f64(d, i)`, for sets wider than Halton_sampler.
+static inline void generate_halton_set(const halton_engine& engine, uint64_t n, uint32_t dims,
+                                       double* out, unsigned int threads = 1) {
+  if(dims > engine.num_dims()) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  for_each_set_tile(n, dims, threads,
+    [&](uint64_t row_start, uint64_t row_count, uint32_t dim_start, uint32_t dim_count) {
+      for(uint32_t d = dim_start; d < dim_start + dim_count; d++) {
+        double* column = out + d * n;
+        for(uint64_t i = row_start; i < row_start + row_count; i++) {
+          column[i] = engine.sample_f64(d, (uint32_t)i);
+        }
+      }
+    });
+}
+
+} //namespace spacefillr
+
+#endif
@@ -16,6 +16,8 @@
 #define SAMPLE_GENERATION_PMJ_H_
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
@@ -35,9 +37,104 @@ std::unique_ptr<Point[]> GetProgMultiJitteredSamples(
     const int num_samples, random_gen& rng);
 
 // Generates progressive multi-jittered samples with blue noise properties, i.e.
-// using best-candidate points.
+// using best-candidate points. The candidates of each point are evaluated on
+// `num_threads` threads; the result doesn't depend on the thread count.
 std::unique_ptr<Point[]> GetProgMultiJitteredSamplesWithBlueNoise(
-    const int num_samples, random_gen& rng);
+    const int num_samples, random_gen& rng, const int num_threads = 1,
+    const int num_candidates = kBestCandidateSamples,
+    const bool adaptive_candidates = false);
+
+/*
+ * Occupancy of n 1D strata, with a binary tree of free-strata counts on top so
+ * that a free stratum can be picked directly instead of by rejection sampling.
+ * The leaves of the tree are 64-strata words of the bit array; node 1 is the
+ * root and node i has children 2i and 2i+1. Any aligned power-of-two block of
+ * words is a single node, which is what a grid cell covers.
+ */
+class StrataOccupancy {
+    public:
+        explicit StrataOccupancy(const int max_n)
+            : bits_((max_n + 63) / 64), free_(2 * bits_.size()) {
+            Reset(1);
+        }
+
+        // Marks all of the first n strata (a power of two) as free.
+        void Reset(const int n) {
+            num_words_ = (n + 63) / 64;
+            // Strata past n in a partial last word count as occupied.
+            std::fill_n(bits_.begin(), num_words_, 0);
+            if (n < 64) bits_[0] = ~((uint64_t(1) << n) - 1);
+            for (int i = 0; i < num_words_; i++) {
+                free_[num_words_ + i] = 64 - Popcount(bits_[i]);
+            }
+            for (int i = num_words_ - 1; i >= 1; i--) {
+                free_[i] = free_[2*i] + free_[2*i+1];
+            }
+        }
+
+        bool operator[](const int i) const {
+            return (bits_[i >> 6] >> (i & 63)) & 1;
+        }
+
+        void Set(const int i) {
+            const uint64_t bit = uint64_t(1) << (i & 63);
+            if (bits_[i >> 6] & bit) return;
+            bits_[i >> 6] |= bit;
+            for (int node = num_words_ + (i >> 6); node >= 1; node >>= 1) {
+                free_[node]--;
+            }
+        }
+
+        // Returns a uniformly chosen free stratum in the aligned block
+        // [first, first + count), with count a power of two. The block must
+        // have a free stratum. Takes one RNG draw and O(log n) work.
+        int SelectFree(const int first, const int count, random_gen& rng) const {
+            if (count <= 64) {
+                const uint64_t mask = count == 64 ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+                const uint64_t free_bits = (~bits_[first >> 6] >> (first & 63)) & mask;
+                const int j = rng.UniformUInt32(Popcount(free_bits));
+                return first + SelectBit(free_bits, j);
+            }
+            int node = (num_words_ + (first >> 6)) / (count / 64);
+            int j = rng.UniformUInt32(free_[node]);
+            while (node < num_words_) {
+                if (j < static_cast<int>(free_[2*node])) {
+                    node = 2*node;
+                } else {
+                    j -= free_[2*node];
+                    node = 2*node + 1;
+                }
+            }
+            const int word = node - num_words_;
+            return word * 64 + SelectBit(~bits_[word], j);
+        }
+
+    private:
+        static int Popcount(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(x);
+#else
+            int count = 0;
+            for (; x; x &= x - 1) count++;
+            return count;
+#endif
+        }
+
+        // Position of the j-th (from 0) set bit of x.
+        static int SelectBit(uint64_t x, int j) {
+            for (; j > 0; j--) x &= x - 1;
+            int pos = 0;
+            while (!(x & 1)) {
+                x >>= 1;
+                pos++;
+            }
+            return pos;
+        }
+
+        std::vector<uint64_t> bits_;
+        std::vector<uint32_t> free_;
+        int num_words_ = 1;
+};
 
 /*
  * The SampleSet is a class that contains the generated samples, as well as the
@@ -48,16 +145,18 @@ class SampleSet2 {
     public:
         explicit SampleSet2(const int num_samples,
                            const int num_candidates,
-                           random_gen& rng_)
-            : num_candidates_(num_candidates), rng(rng_) {
+                           random_gen& rng_,
+                           const int num_threads = 1,
+                           const bool adaptive_candidates = false)
+            : x_strata_(GridMemorySize(num_samples)),
+              y_strata_(GridMemorySize(num_samples)),
+              num_candidates_(num_candidates),
+              adaptive_candidates_(adaptive_candidates), rng(rng_),
+              evaluator_(num_candidates > 1 ? num_threads : 1) {
             samples_ = std::unique_ptr<Point[]>(new Point[num_samples]());
 
-            int grid_memory_size = 1;
-            while (grid_memory_size < num_samples)
-                grid_memory_size <<= 2;
+            const int grid_memory_size = GridMemorySize(num_samples);
             sample_grid_ = std::unique_ptr<const Point*[]>(new const Point*[grid_memory_size]());
-            x_strata_.resize(grid_memory_size);
-            y_strata_.resize(grid_memory_size);
         }
 
         // This generates a new sample at the current index, given the X position
@@ -84,6 +183,13 @@ class SampleSet2 {
         const int dim() const { return dim_; }
 
         private:
+            static int GridMemorySize(const int num_samples) {
+                int grid_memory_size = 1;
+                while (grid_memory_size < num_samples)
+                    grid_memory_size <<= 2;
+                return grid_memory_size;
+            }
+
             // Generates a valid sample at the given cell position, subject to
             // stratification.
             Point GetCandidateSample(const int x_pos, const int y_pos);
@@ -93,14 +199,10 @@ class SampleSet2 {
 
             std::unique_ptr<Point[]> samples_;
 
-            // This could be SIGNIFICANTLY optimized, especially for best-candidate
-            // sampling, by actually storing these as a binary tree, rather than a linear
-            // array, where each node represents whether there are any unoccupied strata
-            // in a range. Then for each sample, you could traverse the tree to get the
-            // unoccupied strata. This would be similar to Matt Pharr's optimization for
-            // PMJ02.
-            std::vector<bool> x_strata_ {false};
-            std::vector<bool> y_strata_ {false};
+            // Occupied 1D strata, with a tree of free counts for picking an
+            // unoccupied one directly.
+            StrataOccupancy x_strata_;
+            StrataOccupancy y_strata_;
 
             // The sample grid is used for nearest neighbor lookups.
             std::unique_ptr<const Point*[]> sample_grid_;
@@ -112,23 +214,28 @@ class SampleSet2 {
 
             // Number of candidates to use for best-candidate sampling.
             const int num_candidates_;
+            // Whether to use fewer candidates as the sample count grows.
+            const bool adaptive_candidates_;
             random_gen rng;
+
+            BestCandidateEvaluator evaluator_;
 };
 
-// This generates a sample within the grid position, verifying that it doesn't
-// overlap strata with any other sample.
+// This generates a sample within the grid position that doesn't overlap strata
+// with any other sample: it picks one of the cell's free strata uniformly, then
+// a uniform position inside it.
 double Get1DStrataSample(const int pos,
                          const int n,
                          const double grid_size,
-                         const std::vector<bool>& strata,
+                         const StrataOccupancy& strata,
                          random_gen& rng) {
-    while (true) {
-        double val = UniformRand(pos*grid_size, (pos+1)*grid_size, rng);
-        int strata_pos = val * n;
-        if (!strata[strata_pos]) {
-            return val;
-        }
-    }
+    const int strata_per_cell = static_cast<int>(n * grid_size);
+    const int strata_pos = strata.SelectFree(pos * strata_per_cell, strata_per_cell, rng);
+    const double strata_min = static_cast<double>(strata_pos) / n;
+    const double strata_max = static_cast<double>(strata_pos + 1) / n;
+    // unif_rand() can round up to 1, which would land on the next stratum.
+    return std::min(UniformRand(strata_min, strata_max, rng),
+                    std::nextafter(strata_max, 0.0));
 }
 
 Point SampleSet2::GetCandidateSample(const int x_pos,
@@ -141,15 +248,17 @@ void SampleSet2::GenerateNewSample(const int sample_index,
                                   const int x_pos,
                                   const int y_pos) {
     Point best_candidate;
-    if (num_candidates_ <= 1) {
+    const int num_candidates =
+        GetCandidateCount(num_candidates_, adaptive_candidates_, sample_index);
+    if (num_candidates <= 1) {
         best_candidate = GetCandidateSample(x_pos, y_pos);
     } else {
-        std::vector<Point> candidate_samples(num_candidates_);
-        for (int i = 0; i < num_candidates_; i++) {
+        std::vector<Point> candidate_samples(num_candidates);
+        for (int i = 0; i < num_candidates; i++) {
             candidate_samples[i] = GetCandidateSample(x_pos, y_pos);
         }
 
-        best_candidate = GetBestCandidateOfSamples(
+        best_candidate = evaluator_.GetBestCandidateOfSamples(
             candidate_samples, sample_grid_.get(), dim_);
     }
     AddSample(sample_index, best_candidate);
@@ -166,13 +275,13 @@ void SampleSet2::SubdivideStrata() {
     }
 
     std::fill_n(sample_grid_.get(), n_, nullptr);
-    std::fill_n(x_strata_.begin(), n_, 0);
-    std::fill_n(y_strata_.begin(), n_, 0);
+    x_strata_.Reset(n_);
+    y_strata_.Reset(n_);
     for (int i = 0; i < old_n; i++) {
         const auto& sample = samples_[i];
 
-        x_strata_[sample.x * n_] = true;
-        y_strata_[sample.y * n_] = true;
+        x_strata_.Set(sample.x * n_);
+        y_strata_.Set(sample.y * n_);
 
         const int x_pos = sample.x * dim_, y_pos = sample.y * dim_;
         sample_grid_[y_pos*dim_ + x_pos] = &sample;
@@ -183,8 +292,8 @@ void SampleSet2::AddSample(const int i,
                           const Point& sample) {
     samples_[i] = sample;
 
-    x_strata_[sample.x * n_] = true;
-    y_strata_[sample.y * n_] = true;
+    x_strata_.Set(sample.x * n_);
+    y_strata_.Set(sample.y * n_);
 
     const int x_pos = sample.x * dim_, y_pos = sample.y * dim_;
     sample_grid_[y_pos*dim_ + x_pos] = &(samples_[i]);
@@ -197,8 +306,11 @@ std::unique_ptr<Point[]> GenerateSamples2(
         const int num_samples,
         const int num_candidates,
         random_gen& rng,
-        const subquad_fn subquad_func = &GetSubQuadrantsOxPlowing) {
-    SampleSet2 sample_set(num_samples, num_candidates, rng);
+        const subquad_fn subquad_func = &GetSubQuadrantsOxPlowing,
+        const int num_threads = 1,
+        const bool adaptive_candidates = false) {
+    SampleSet2 sample_set(num_samples, num_candidates, rng, num_threads,
+                          adaptive_candidates);
 
     // Generate first sample.
     sample_set.GenerateNewSample(0, 0, 0);
@@ -260,8 +372,10 @@ std::unique_ptr<Point[]> GetProgMultiJitteredSamples(
     return GenerateSamples2(num_samples, /*num_candidates=*/1, rng);
 }
 std::unique_ptr<Point[]> GetProgMultiJitteredSamplesWithBlueNoise(
-        const int num_samples, random_gen& rng) {
-    return GenerateSamples2(num_samples, kBestCandidateSamples, rng);
+        const int num_samples, random_gen& rng, const int num_threads,
+        const int num_candidates, const bool adaptive_candidates) {
+    return GenerateSamples2(num_samples, num_candidates, rng,
+                            &GetSubQuadrantsOxPlowing, num_threads, adaptive_candidates);
 }
 
 }  // namespace pmj
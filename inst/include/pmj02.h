@@ -20,11 +20,17 @@
 #define SAMPLE_GENERATION_PMJ02_H_
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <random>
 #include <stack>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -40,9 +46,12 @@ namespace {
 std::unique_ptr<Point[]> GetPMJ02Samples(const int num_samples, random_gen& rng);
 
 // Generates progressive multi-jittered (0,2) samples with blue noise
-// properties.
+// properties. The candidates of each point are evaluated on `num_threads`
+// threads; the result doesn't depend on the thread count.
 std::unique_ptr<Point[]> GetPMJ02SamplesWithBlueNoise(
-    const int num_samples, random_gen& rng);
+    const int num_samples, random_gen& rng, const int num_threads = 1,
+    const int num_candidates = kBestCandidateSamples,
+    const bool adaptive_candidates = false);
 
 /*
  * -----------------------------------------------------------------------
@@ -53,6 +62,7 @@ std::unique_ptr<Point[]> GetPMJ02SamplesWithBlueNoise(
 
 using std::vector;
 
+}//namespace
 
 /*
  * The SampleSet is a class that contains the generated samples, as well as the
@@ -63,18 +73,44 @@ class SampleSet {
     public:
         explicit SampleSet(const int num_samples,
                            const int num_candidates,
-                           random_gen& _rng)
-            : num_candidates_(num_candidates), rng(_rng) {
+                           random_gen& _rng,
+                           const int num_threads = 1,
+                           const bool adaptive_candidates = false)
+            : strata_(num_samples), num_samples_(num_samples),
+              num_candidates_(num_candidates),
+              adaptive_candidates_(adaptive_candidates), rng(_rng),
+              evaluator_(num_candidates > 1 ? num_threads : 1) {
             samples_ = std::unique_ptr<Point[]>(new Point[num_samples]());
             std::fill_n(samples_.get(), num_samples, Point({0.0, 0.0}));
+            fixed_x_ = std::unique_ptr<uint32_t[]>(new uint32_t[num_samples]());
+            fixed_y_ = std::unique_ptr<uint32_t[]>(new uint32_t[num_samples]());
 
-            int grid_memory_size = 1;
-            while (grid_memory_size < num_samples)
-                grid_memory_size <<= 2;
+            const int grid_memory_size = GridMemorySize(num_samples);
             sample_grid_ = std::unique_ptr<const Point*[]>(new const Point*[grid_memory_size]());
             std::fill_n(sample_grid_.get(), grid_memory_size, nullptr);
         }
 
+        // Starts a new sequence drawn from `_rng`, keeping all allocations.
+        void Reset(random_gen& _rng) {
+            rng = _rng;
+            n_ = 1;
+            is_power_of_4_ = true;
+            dim_ = 1;
+            strata_.Reset(1);
+            std::fill_n(sample_grid_.get(), GridMemorySize(num_samples_), nullptr);
+        }
+
+        // Grows the capacity of the set to `num_samples`, keeping its state.
+        void Reserve(const int num_samples);
+
+        // Puts the set in the state it has after generating `count` samples,
+        // where `count` is zero or a power of two, given those samples and the
+        // random generator at that point.
+        void Restore(const Point samples[], const int count,
+                     const random_gen& _rng);
+
+        const random_gen& rng_state() const { return rng; }
+
         void GenerateFirstSample();
 
         // This generates a new sample at the given index, given the X position and Y
@@ -102,6 +138,14 @@ class SampleSet {
         const int dim() const { return dim_; }
 
         private:
+            // Number of grid cells needed for `num_samples`, a power of 4.
+            static int GridMemorySize(const int num_samples) {
+                int grid_memory_size = 1;
+                while (grid_memory_size < num_samples)
+                    grid_memory_size <<= 2;
+                return grid_memory_size;
+            }
+
             // Adds a new point at index i. Updates the necessary data structures.
             void AddSample(const int i, const Point& sample);
 
@@ -113,9 +157,18 @@ class SampleSet {
 
             std::unique_ptr<Point[]> samples_;
 
-            // Contains all strata of elementary (0,2) intervals. Each value is true/false
-            // representing if a sample point resides there.
-            vector<vector<bool>> strata_ {{false}};
+            // Sample coordinates as 32-bit fixed point, so the stratum at any
+            // level is a pair of shifts: floor(x * 2^k) == fixed_x_ >> (32 - k).
+            std::unique_ptr<uint32_t[]> fixed_x_;
+            std::unique_ptr<uint32_t[]> fixed_y_;
+
+            // Contains all strata of elementary (0,2) intervals. Each bit is set if a
+            // sample point resides there.
+            ElementaryStrata strata_;
+
+            // Scratch reused by every GenerateNewSample call.
+            ValidStrata valid_strata_;
+            vector<Point> candidate_samples_;
 
             // The sample grid is used for nearest neighbor lookups.
             std::unique_ptr<const Point*[]> sample_grid_;
@@ -124,12 +177,73 @@ class SampleSet {
             bool is_power_of_4_ = true;
             int dim_ = 1;  // Number of cells in one dimension in next pass, i.e. sqrt(n).
 
+            // Capacity of the set.
+            int num_samples_;
+
             // Number of candidates to use for best-candidate sampling.
             const int num_candidates_;
+            // Whether to use fewer candidates as the sample count grows.
+            const bool adaptive_candidates_;
             random_gen rng;
+
+            BestCandidateEvaluator evaluator_;
 };
 
-void SampleSet::SubdivideStrata() {
+inline void SampleSet::Reserve(const int num_samples) {
+    if (num_samples <= num_samples_) return;
+
+    std::unique_ptr<Point[]> samples(new Point[num_samples]());
+    std::copy_n(samples_.get(), num_samples_, samples.get());
+    std::unique_ptr<uint32_t[]> fixed_x(new uint32_t[num_samples]());
+    std::copy_n(fixed_x_.get(), num_samples_, fixed_x.get());
+    std::unique_ptr<uint32_t[]> fixed_y(new uint32_t[num_samples]());
+    std::copy_n(fixed_y_.get(), num_samples_, fixed_y.get());
+    strata_.Reserve(num_samples);
+
+    // The grid points into samples_, so it's moved over to the new array.
+    const int old_grid_size = GridMemorySize(num_samples_);
+    const int grid_memory_size = GridMemorySize(num_samples);
+    std::unique_ptr<const Point*[]> sample_grid(new const Point*[grid_memory_size]());
+    std::fill_n(sample_grid.get(), grid_memory_size, nullptr);
+    for (int i = 0; i < old_grid_size; i++) {
+        if (sample_grid_[i] != nullptr) {
+            sample_grid[i] = samples.get() + (sample_grid_[i] - samples_.get());
+        }
+    }
+
+    samples_ = std::move(samples);
+    fixed_x_ = std::move(fixed_x);
+    fixed_y_ = std::move(fixed_y);
+    sample_grid_ = std::move(sample_grid);
+    num_samples_ = num_samples;
+}
+
+inline void SampleSet::Restore(const Point samples[], const int count,
+                        const random_gen& _rng) {
+    Reserve(count);
+    rng = _rng;
+
+    // Replays the SubdivideStrata calls up to `count` samples.
+    n_ = 1;
+    is_power_of_4_ = true;
+    dim_ = 1;
+    int num_levels = 1;
+    while (n_ < count) {
+        n_ *= 2;
+        is_power_of_4_ = !is_power_of_4_;
+        if (!is_power_of_4_) {
+            dim_ *= 2;
+        }
+        num_levels++;
+    }
+    strata_.Reset(num_levels);
+    std::fill_n(sample_grid_.get(), GridMemorySize(num_samples_), nullptr);
+    for (int i = 0; i < count; i++) {
+        AddSample(i, samples[i]);
+    }
+}
+
+inline void SampleSet::SubdivideStrata() {
     const int old_n = n_;
 
     n_ *= 2;
@@ -140,19 +254,36 @@ void SampleSet::SubdivideStrata() {
 
     // For the first sample this is 1x1. For sample 2 it's 1x2 and 2x1. For
     // samples 3-4 it's 4x1, 2x2, and 1x4. So every time it goes up by one.
-    strata_.resize(strata_.size()+1);
+    // All old_n samples are in place, so every stratum of the previous pass
+    // holds exactly one of them. Each stratum is now split in two, level 0
+    // into two columns and level i into two rows of the old level i-1, and
+    // exactly one half of each pair is occupied. So only the samples in first
+    // halves need to be marked; the second halves are their complement.
+    strata_.Reset(strata_.size()+1);
+    const int log_n = strata_.size() - 1;
+    for (int level = 0; level <= log_n; level++) {
+        const int x_bits = log_n - level;
+        const int y_bits = level;
+        for (int i = 0; i < old_n; i++) {
+            const uint32_t x_pos = uint64_t(fixed_x_[i]) >> (32 - x_bits);
+            const uint32_t y_pos = uint64_t(fixed_y_[i]) >> (32 - y_bits);
+            if (((level == 0 ? x_pos : y_pos) & 1) == 0) {
+                strata_.Set(level, (y_pos << x_bits) | x_pos);
+            }
+        }
+        strata_.ComplementPairs(level, level == 0 ? 1 : 1 << x_bits);
+    }
 
-    // Clear all the strata and mark the occupied ones again.
-    std::fill(strata_.begin(), strata_.end(), vector<bool>(n_, false));
     std::fill_n(sample_grid_.get(), n_, nullptr);
     for (int i = 0; i < old_n; i++) {
-        UpdateStrata(i);
+        const int x_pos = samples_[i].x * dim_, y_pos = samples_[i].y * dim_;
+        sample_grid_[y_pos*dim_ + x_pos] = &samples_[i];
     }
 }
 
 // This generates a sample within the grid position, verifying that it doesn't
 // overlap strata with any other sample.
-Point SampleSet::GetCandidateSample(const vector<int>& valid_x_strata,
+inline Point SampleSet::GetCandidateSample(const vector<int>& valid_x_strata,
                                     const vector<int>& valid_y_strata) {
     Point sample;
 
@@ -170,36 +301,37 @@ Point SampleSet::GetCandidateSample(const vector<int>& valid_x_strata,
     return sample;
 }
 
-void SampleSet::GenerateFirstSample() {
+inline void SampleSet::GenerateFirstSample() {
     Point sample = {UniformRand(0,1,rng), UniformRand(0,1,rng)};
     AddSample(0, sample);
 }
 
-void SampleSet::GenerateNewSample(const int sample_index,
+inline void SampleSet::GenerateNewSample(const int sample_index,
                                   const int x_pos,
                                   const int y_pos) {
     Point best_candidate;
 
-    const std::pair<vector<int>, vector<int>>& valid_strata =
-        GetValidStrata(x_pos, y_pos, strata_);
+    GetValidStrata(x_pos, y_pos, strata_, &valid_strata_);
 
-    if (num_candidates_ <= 1) {
+    const int num_candidates =
+        GetCandidateCount(num_candidates_, adaptive_candidates_, sample_index);
+    if (num_candidates <= 1) {
         best_candidate =
-            GetCandidateSample(valid_strata.first, valid_strata.second);
+            GetCandidateSample(valid_strata_.x, valid_strata_.y);
     } else {
-        vector<Point> candidate_samples(num_candidates_);
-        for (int i = 0; i < num_candidates_; i++) {
-            candidate_samples[i] =
-                GetCandidateSample(valid_strata.first, valid_strata.second);
+        candidate_samples_.resize(num_candidates);
+        for (int i = 0; i < num_candidates; i++) {
+            candidate_samples_[i] =
+                GetCandidateSample(valid_strata_.x, valid_strata_.y);
         }
 
-        best_candidate = GetBestCandidateOfSamples(
-            candidate_samples, sample_grid_.get(), dim_);
+        best_candidate = evaluator_.GetBestCandidateOfSamples(
+            candidate_samples_, sample_grid_.get(), dim_);
     }
     AddSample(sample_index, best_candidate);
 }
 
-void SampleSet::UpdateStrata(const int sample_index) {
+inline void SampleSet::UpdateStrata(const int sample_index) {
     const Point& sample = samples_[sample_index];
 
     for (int i = 0, strata_n_cols = n_, strata_n_rows = 1;
@@ -207,28 +339,29 @@ void SampleSet::UpdateStrata(const int sample_index) {
          strata_n_cols /= 2, strata_n_rows *= 2, i++) {
         int x_pos = sample.x * strata_n_cols;
         int y_pos = sample.y * strata_n_rows;
-        strata_[i][y_pos*strata_n_cols + x_pos] = true;
+        strata_.Set(i, y_pos*strata_n_cols + x_pos);
     }
 
     const int x_pos = sample.x * dim_, y_pos = sample.y * dim_;
     sample_grid_[y_pos*dim_ + x_pos] = &sample;
 }
 
-void SampleSet::AddSample(const int i,
+inline void SampleSet::AddSample(const int i,
                           const Point& sample) {
     samples_[i] = sample;
+    fixed_x_[i] = static_cast<uint32_t>(sample.x * 4294967296.0);
+    fixed_y_[i] = static_cast<uint32_t>(sample.y * 4294967296.0);
     UpdateStrata(i);
 }
 
+namespace {
 /*
  * The core of Christensen et al.'s algorithm.
  */
-std::unique_ptr<Point[]> GenerateSamples(
-        const int num_samples,
-        const int num_candidates, random_gen& rng,
-        const subquad_fn subquad_func = &GetSubQuadrantsSwapXOrY) {
-    SampleSet sample_set(num_samples, num_candidates, rng);
-
+void FillSampleSet(SampleSet& sample_set,
+                   const int num_samples,
+                   random_gen& rng,
+                   const subquad_fn subquad_func) {
     sample_set.GenerateFirstSample();
 
     // Number of samples from the previous iteration. Always a power of 4.
@@ -275,22 +408,233 @@ std::unique_ptr<Point[]> GenerateSamples(
 
         n *= 4;
     }
+}
 
+std::unique_ptr<Point[]> GenerateSamples(
+        const int num_samples,
+        const int num_candidates, random_gen& rng,
+        const subquad_fn subquad_func = &GetSubQuadrantsSwapXOrY,
+        const int num_threads = 1,
+        const bool adaptive_candidates = false) {
+    SampleSet sample_set(num_samples, num_candidates, rng, num_threads,
+                         adaptive_candidates);
+    FillSampleSet(sample_set, num_samples, rng, subquad_func);
     return sample_set.ReleaseSamples();
 }
 
 
+
+
 std::unique_ptr<Point[]> GetPMJ02Samples(
         const int num_samples, random_gen& rng) {
     return GenerateSamples(num_samples, /*num_candidates=*/1, rng);
 }
 std::unique_ptr<Point[]> GetPMJ02SamplesWithBlueNoise(
-        const int num_samples, random_gen& rng) {
-    return GenerateSamples(num_samples, kBestCandidateSamples, rng);
+        const int num_samples, random_gen& rng, const int num_threads,
+        const int num_candidates, const bool adaptive_candidates) {
+    return GenerateSamples(num_samples, num_candidates, rng,
+                           &GetSubQuadrantsSwapXOrY, num_threads, adaptive_candidates);
 }
 
 }//namespace
 
+/*
+ * Generates a PMJ02 sequence progressively, in power-of-two chunks: [0, 1),
+ * [1, 2), [2, 4), [4, 8) and so on. The first n samples are the same as
+ * GetPMJ02Samples (or GetPMJ02SamplesWithBlueNoise) with the same rng would
+ * return for n samples, so a caller can start with a few samples and ask for
+ * more later without regenerating anything or knowing the final count. The
+ * state between chunks can be saved with Serialize() and restored with
+ * Deserialize().
+ */
+class PMJ02Generator {
+    public:
+        explicit PMJ02Generator(random_gen& rng,
+                                const int num_candidates = 1,
+                                const bool adaptive_candidates = false,
+                                const int num_threads = 1)
+            : sample_set_(new SampleSet(1, num_candidates, rng, num_threads,
+                                        adaptive_candidates)),
+              rng_(rng),
+              num_candidates_(num_candidates),
+              adaptive_candidates_(adaptive_candidates) {}
+
+        // Generates the next chunk of size() samples (1 for the first chunk)
+        // and returns the new size.
+        int GenerateNextChunk();
+
+        // Generates chunks until there are at least `num_samples` samples.
+        void GenerateAtLeast(const int num_samples) {
+            while (size_ < num_samples) GenerateNextChunk();
+        }
+
+        int size() const { return size_; }
+        const Point& sample(const int sample_index) const {
+            return sample_set_->sample(sample_index);
+        }
+        const Point* samples() const { return sample_set_->samples(); }
+
+        // Writes the state as text. Samples are stored bit for bit, so a
+        // restored generator continues exactly where this one stopped.
+        void Serialize(std::ostream& out) const;
+
+        // Reads a state written by Serialize(). Throws std::runtime_error on
+        // malformed input.
+        static PMJ02Generator Deserialize(std::istream& in,
+                                          const int num_threads = 1);
+
+    private:
+        std::unique_ptr<SampleSet> sample_set_;
+        // Drives the subquadrant choices, like the rng of GenerateSamples.
+        random_gen rng_;
+        int size_ = 0;
+        int num_candidates_;
+        bool adaptive_candidates_;
+
+        static constexpr const char* kTag = "spacefillr-pmj02-generator";
+        static constexpr int kVersion = 1;
+};
+
+inline int PMJ02Generator::GenerateNextChunk() {
+    SampleSet& sample_set = *sample_set_;
+    if (size_ == 0) {
+        sample_set.GenerateFirstSample();
+        size_ = 1;
+        return size_;
+    }
+    if (size_ >= (1 << 30)) {
+        throw std::runtime_error("PMJ02Generator is limited to 2^30 samples");
+    }
+    sample_set.Reserve(2*size_);
+    sample_set.SubdivideStrata();
+
+    // One pass of FillSampleSet per chunk: after a power of 4 samples come the
+    // diagonally opposite ones, after that the remaining subquadrants.
+    const bool is_power_of_4 = (size_ & 0x55555555) != 0;
+    if (is_power_of_4) {
+        const int n = size_;
+        for (int i = 0; i < n; i++) {
+            const Point& sample = sample_set.sample(i);
+
+            int x_pos = sample.x * sample_set.dim();
+            int y_pos = sample.y * sample_set.dim();
+
+            sample_set.GenerateNewSample(/*sample_index=*/n+i, x_pos ^ 1, y_pos ^ 1);
+        }
+    } else {
+        const int n = size_ / 2;
+        const std::vector<std::pair<int, int>> sub_quad_choices =
+            GetSubQuadrantsSwapXOrY(sample_set.samples(), sample_set.dim(), rng_);
+        for (int i = 0; i < n; i++) {
+            sample_set.GenerateNewSample(/*sample_index=*/2*n+i,
+                                         sub_quad_choices[i].first,
+                                         sub_quad_choices[i].second);
+        }
+        for (int i = 0; i < n; i++) {
+            sample_set.GenerateNewSample(/*sample_index=*/3*n+i,
+                                         sub_quad_choices[i].first ^ 1,
+                                         sub_quad_choices[i].second ^ 1);
+        }
+    }
+    size_ *= 2;
+    return size_;
+}
+
+inline void PMJ02Generator::Serialize(std::ostream& out) const {
+    out << kTag << ' ' << kVersion << '\n'
+        << num_candidates_ << ' ' << adaptive_candidates_ << ' ' << size_ << '\n'
+        << rng_.rng << '\n'
+        << sample_set_->rng_state().rng << '\n';
+    const std::ios_base::fmtflags flags = out.flags();
+    out << std::hex;
+    for (int i = 0; i < size_; i++) {
+        const Point& sample = sample_set_->sample(i);
+        uint64_t x_bits, y_bits;
+        std::memcpy(&x_bits, &sample.x, sizeof(x_bits));
+        std::memcpy(&y_bits, &sample.y, sizeof(y_bits));
+        out << x_bits << ' ' << y_bits << '\n';
+    }
+    out.flags(flags);
+}
+
+inline PMJ02Generator PMJ02Generator::Deserialize(std::istream& in,
+                                           const int num_threads) {
+    std::string tag;
+    int version = 0, num_candidates = 0, adaptive_candidates = 0, size = -1;
+    in >> tag >> version >> num_candidates >> adaptive_candidates >> size;
+    if (!in || tag != kTag) {
+        throw std::runtime_error("Not a PMJ02Generator state");
+    }
+    if (version != kVersion) {
+        throw std::runtime_error("Unsupported PMJ02Generator state version");
+    }
+    if (num_candidates < 1) {
+        throw std::runtime_error("Invalid PMJ02Generator candidate count");
+    }
+    if (size < 0 || size > (1 << 30) || (size & (size - 1)) != 0) {
+        throw std::runtime_error("Invalid PMJ02Generator sample count");
+    }
+
+    random_gen rng(0), sample_set_rng(0);
+    in >> rng.rng >> sample_set_rng.rng;
+    std::vector<Point> samples(size);
+    const std::ios_base::fmtflags flags = in.flags();
+    in >> std::hex;
+    for (int i = 0; i < size && in; i++) {
+        uint64_t x_bits, y_bits;
+        in >> x_bits >> y_bits;
+        std::memcpy(&samples[i].x, &x_bits, sizeof(x_bits));
+        std::memcpy(&samples[i].y, &y_bits, sizeof(y_bits));
+        if (!(samples[i].x >= 0.0 && samples[i].x < 1.0 &&
+              samples[i].y >= 0.0 && samples[i].y < 1.0)) {
+            in.setstate(std::ios_base::failbit);
+        }
+    }
+    in.flags(flags);
+    if (!in) {
+        throw std::runtime_error("Truncated or malformed PMJ02Generator state");
+    }
+
+    PMJ02Generator generator(rng, num_candidates, adaptive_candidates != 0,
+                             num_threads);
+    generator.sample_set_->Restore(samples.data(), size, sample_set_rng);
+    generator.size_ = size;
+    return generator;
+}
+
+// Generates `num_sequences` independent PMJ02 sequences of `num_samples`
+// points, sequence s being the one GetPMJ02Samples (or, with num_candidates > 1,
+// GetPMJ02SamplesWithBlueNoise) produces from random_gen(first_seed + s). It
+// is written to out[s * num_samples, (s + 1) * num_samples). Sequences are
+// spread over `num_threads` threads, each reusing one SampleSet, and the
+// output doesn't depend on the thread count.
+inline void GetPMJ02SampleBatch(const int num_samples, const uint32_t first_seed,
+                                const int num_sequences, Point out[],
+                                const int num_threads = 1,
+                                const int num_candidates = 1) {
+    std::atomic<int> next_sequence(0);
+    auto worker = [&]() {
+        random_gen rng(first_seed);
+        SampleSet sample_set(num_samples, num_candidates, rng);
+        for (int s = next_sequence++; s < num_sequences; s = next_sequence++) {
+            rng = random_gen(first_seed + s);
+            sample_set.Reset(rng);
+            FillSampleSet(sample_set, num_samples, rng, &GetSubQuadrantsSwapXOrY);
+            std::copy_n(sample_set.samples(), num_samples,
+                        out + static_cast<size_t>(s) * num_samples);
+        }
+    };
+    const int pool_size = std::min(std::max(num_threads, 1), num_sequences);
+    std::vector<std::thread> pool;
+    for (int i = 1; i < pool_size; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
 }  // namespace pmj
 
 #endif  // SAMPLE_GENERATION_PMJ02_H_
@@ -0,0 +1,233 @@
+#ifndef PMJ02TABLESH
+#define PMJ02TABLESH
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define SPACEFILLR_PMJ02_TABLES_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "pmj02.h"
+#include "rng.h"
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Precomputed PMJ02 tables
+//
+// PMJ02-BN runs at roughly 500k samples/sec, so renderers are better off
+// generating a set of tables once and looking values up. A table file holds
+// `num_tables` sequences of `num_samples` points each; table `t` is the
+// sequence generated from `random_gen(seed + t)`. After the header, point `i`
+// of table `t` is stored at pair `t * num_samples + i` as two 32-bit
+// fixed-point coordinates (x, y), i.e. `floor(value * 2^32)`. Truncation keeps
+// every point in its (0,2) strata down to 2^-32. All fields are in native byte
+// order; `byte_order` lets a reader reject a file written on the other
+// endianness.
+
+static const char Pmj02TableMagic[8] = {'S', 'F', 'P', 'M', 'J', '0', '2', 'T'};
+static const uint32_t Pmj02TableVersion = 1;
+static const uint32_t Pmj02TableByteOrder = 0x01020304;
+
+struct pmj02_table_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t num_tables;
+  uint32_t num_samples;
+  uint32_t seed;
+  // 1 for plain PMJ02, otherwise the best-candidate count of PMJ02-BN.
+  uint32_t num_candidates;
+};
+
+static_assert(sizeof(pmj02_table_header) == 32, "pmj02_table_header must be packed");
+
+// Converts `n` points to fixed-point pairs in `out` (2 * n values).
+static inline void pmj02_points_to_fixed_point(const pmj::Point* points, size_t n, uint32_t* out) {
+  for(size_t i = 0; i < n; i++) {
+    out[2 * i] = (uint32_t)(points[i].x * 4294967296.0);
+    out[2 * i + 1] = (uint32_t)(points[i].y * 4294967296.0);
+  }
+}
+
+// Writes the fixed-point pairs of one table to `out` (2 * num_samples values).
+static inline void generate_pmj02_table(uint32_t seed, uint32_t num_samples,
+                                        uint32_t num_candidates, uint32_t* out,
+                                        unsigned int threads = 1) {
+  random_gen rng(seed);
+  std::unique_ptr<pmj::Point[]> points = num_candidates > 1 ?
+    pmj::GetPMJ02SamplesWithBlueNoise(num_samples, rng, threads, num_candidates) :
+    pmj::GetPMJ02Samples(num_samples, rng);
+  pmj02_points_to_fixed_point(points.get(), num_samples, out);
+}
+
+// Generates `num_tables` tables and writes them to the file at `path`.
+static inline void write_pmj02_table_file(const std::string& path, uint32_t num_tables,
+                                          uint32_t num_samples, uint32_t seed,
+                                          uint32_t num_candidates = 1,
+                                          unsigned int threads = 1) {
+  if(num_samples == 0 || num_samples > (1u << 30)) {
+    throw std::runtime_error("PMJ02 table size must be between 1 and 2^30 samples");
+  }
+  pmj02_table_header header;
+  std::memcpy(header.magic, Pmj02TableMagic, sizeof(header.magic));
+  header.version = Pmj02TableVersion;
+  header.byte_order = Pmj02TableByteOrder;
+  header.num_tables = num_tables;
+  header.num_samples = num_samples;
+  header.seed = seed;
+  header.num_candidates = num_candidates < 1 ? 1 : num_candidates;
+
+  std::unique_ptr<std::FILE, int(*)(std::FILE*)> f(std::fopen(path.c_str(), "wb"), &std::fclose);
+  if(!f) {
+    throw std::runtime_error("Could not open " + path + " for writing");
+  }
+  bool ok = std::fwrite(&header, sizeof(header), 1, f.get()) == 1;
+  // One table per thread at a time.
+  const uint32_t chunk = threads > 1 ? threads : 1;
+  std::vector<pmj::Point> points((size_t)chunk * num_samples);
+  std::vector<uint32_t> pairs(2 * points.size());
+  for(uint32_t t = 0; t < num_tables && ok; t += chunk) {
+    const uint32_t count = std::min(chunk, num_tables - t);
+    const size_t num_points = (size_t)count * num_samples;
+    pmj::GetPMJ02SampleBatch(num_samples, seed + t, count, points.data(), threads,
+                             header.num_candidates);
+    pmj02_points_to_fixed_point(points.data(), num_points, pairs.data());
+    ok = std::fwrite(pairs.data(), sizeof(uint32_t), 2 * num_points, f.get()) == 2 * num_points;
+  }
+  if(!ok || std::fflush(f.get()) != 0) {
+    throw std::runtime_error("Could not write " + path);
+  }
+}
+
+// Read-only view of a table file. The file is memory-mapped (read into memory
+// on Windows), so processes opening the same file share one copy of the tables
+// through the page cache. Lookups are O(1) and thread-safe.
+class pmj02_table_file {
+public:
+  explicit pmj02_table_file(const std::string& path) {
+#ifdef SPACEFILLR_PMJ02_TABLES_NO_MMAP
+    std::unique_ptr<std::FILE, int(*)(std::FILE*)> f(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if(!f) {
+      throw std::runtime_error("Could not open " + path);
+    }
+    std::fseek(f.get(), 0, SEEK_END);
+    const long bytes = std::ftell(f.get());
+    std::fseek(f.get(), 0, SEEK_SET);
+    if(bytes < (long)sizeof(pmj02_table_header)) {
+      throw std::runtime_error(path + " is not a PMJ02 table file");
+    }
+    contents_.resize(((size_t)bytes + 7) / 8);
+    if(std::fread(contents_.data(), 1, (size_t)bytes, f.get()) != (size_t)bytes) {
+      throw std::runtime_error("Could not read " + path);
+    }
+    data_ = (const char*)contents_.data();
+    size_ = (size_t)bytes;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+      throw std::runtime_error("Could not open " + path);
+    }
+    struct stat st;
+    if(::fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(pmj02_table_header)) {
+      ::close(fd);
+      throw std::runtime_error(path + " is not a PMJ02 table file");
+    }
+    size_ = (size_t)st.st_size;
+    void* map = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(map == MAP_FAILED) {
+      throw std::runtime_error("Could not map " + path);
+    }
+    data_ = (const char*)map;
+#endif
+    try {
+      validate(path);
+    } catch(...) {
+      release();
+      throw;
+    }
+    pairs_ = (const uint32_t*)(data_ + sizeof(pmj02_table_header));
+  }
+
+  ~pmj02_table_file() {
+    release();
+  }
+
+  pmj02_table_file(const pmj02_table_file&) = delete;
+  pmj02_table_file& operator=(const pmj02_table_file&) = delete;
+
+  uint32_t num_tables() const { return(header().num_tables); }
+  uint32_t num_samples() const { return(header().num_samples); }
+  uint32_t seed() const { return(header().seed); }
+  uint32_t num_candidates() const { return(header().num_candidates); }
+
+  // The fixed-point (x, y) pair of point `index` of table `table_id`. Both must
+  // be in range.
+  const uint32_t* fixed_point(uint32_t table_id, uint32_t index) const {
+    return(pairs_ + 2 * ((size_t)table_id * num_samples_ + index));
+  }
+
+  pmj::Point sample(uint32_t table_id, uint32_t index) const {
+    const uint32_t* p = fixed_point(table_id, index);
+    const pmj::Point point = {p[0] * 0x1p-32, p[1] * 0x1p-32};
+    return(point);
+  }
+
+private:
+  const pmj02_table_header& header() const {
+    return(*(const pmj02_table_header*)data_);
+  }
+
+  void validate(const std::string& path) {
+    if(size_ < sizeof(pmj02_table_header) ||
+       std::memcmp(header().magic, Pmj02TableMagic, sizeof(Pmj02TableMagic)) != 0) {
+      throw std::runtime_error(path + " is not a PMJ02 table file");
+    }
+    if(header().version != Pmj02TableVersion) {
+      throw std::runtime_error(path + " has an unsupported PMJ02 table version");
+    }
+    if(header().byte_order != Pmj02TableByteOrder) {
+      throw std::runtime_error(path + " was written with a different byte order");
+    }
+    num_samples_ = header().num_samples;
+    const uint64_t expected = sizeof(pmj02_table_header) +
+      (uint64_t)header().num_tables * num_samples_ * 2 * sizeof(uint32_t);
+    if(size_ != expected) {
+      throw std::runtime_error(path + " is truncated or has the wrong size");
+    }
+  }
+
+  void release() {
+#ifndef SPACEFILLR_PMJ02_TABLES_NO_MMAP
+    if(data_) {
+      ::munmap((void*)data_, size_);
+    }
+#endif
+    data_ = nullptr;
+  }
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  const uint32_t* pairs_ = nullptr;
+  size_t num_samples_ = 0;
+#ifdef SPACEFILLR_PMJ02_TABLES_NO_MMAP
+  std::vector<uint64_t> contents_;
+#endif
+};
+
+} //namespace spacefillr
+
+#endif
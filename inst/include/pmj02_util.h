@@ -7,6 +7,8 @@
 #ifndef SAMPLE_GENERATION_PMJ02_UTIL_H_
 #define SAMPLE_GENERATION_PMJ02_UTIL_H_
 
+#include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -14,69 +16,186 @@ namespace pmj {
 
 using std::vector;
 
+// Occupancy of all elementary (0,2) intervals for n = 2^(num_levels-1) cells.
+// Level i has n >> i columns and 1 << i rows, so every level holds n bits.
+// All levels live in one bit array, sized once for the largest n; a level
+// starts at a whole word, and its offset is computed from the level index.
+class ElementaryStrata {
+    public:
+        explicit ElementaryStrata(const int max_n) {
+            Reserve(max_n);
+            Reset(1);
+        }
+
+        // Makes room for up to `max_n` samples. The current levels keep their
+        // contents, since their layout only depends on the current n.
+        void Reserve(const int max_n) {
+            int max_levels = 1;
+            while ((1 << (max_levels - 1)) < max_n) max_levels++;
+            const size_t size = static_cast<size_t>(max_levels) *
+                                WordsPerLevel(1 << (max_levels - 1));
+            if (size > bits_.size()) bits_.resize(size);
+        }
+
+        // Sets up `num_levels` levels, all unoccupied.
+        void Reset(const int num_levels) {
+            num_levels_ = num_levels;
+            n_ = 1 << (num_levels - 1);
+            std::fill_n(bits_.begin(), num_levels_ * WordsPerLevel(n_), 0);
+        }
+
+        int size() const { return num_levels_; }
+
+        bool Get(const int level, const int index) const {
+            const size_t bit = Offset(level) + index;
+            return (bits_[bit >> 6] >> (bit & 63)) & 1;
+        }
+
+        void Set(const int level, const int index) {
+            const size_t bit = Offset(level) + index;
+            bits_[bit >> 6] |= uint64_t(1) << (bit & 63);
+        }
+
+        // Splits `level` into aligned pairs of `width`-bit groups (width is a
+        // power of two) and sets the second group of each pair to the
+        // complement of the first.
+        void ComplementPairs(const int level, const int width) {
+            uint64_t* words = bits_.data() + Offset(level) / 64;
+            if (width >= 64) {
+                const int group_words = width / 64;
+                for (int i = 0; i < n_ / 64; i += 2 * group_words) {
+                    for (int j = 0; j < group_words; j++) {
+                        words[i + group_words + j] = ~words[i + j];
+                    }
+                }
+                return;
+            }
+            // Several groups per word: `first` selects the first group of
+            // every pair.
+            uint64_t first = 0;
+            for (int b = 0; b < 64; b += 2 * width) {
+                first |= ((uint64_t(1) << width) - 1) << b;
+            }
+            const uint64_t used = n_ >= 64 ? ~uint64_t(0) : (uint64_t(1) << n_) - 1;
+            for (size_t i = 0; i < WordsPerLevel(n_); i++) {
+                words[i] = (words[i] & first) | (((~words[i] & first) << width) & used);
+            }
+        }
+
+    private:
+        static size_t WordsPerLevel(const int n) { return (n + 63) / 64; }
+
+        size_t Offset(const int level) const {
+            return static_cast<size_t>(level) * WordsPerLevel(n_) * 64;
+        }
+
+        vector<uint64_t> bits_;
+        int num_levels_ = 1;
+        int n_ = 1;
+};
+
+// Unoccupied strata found by GetValidStrata. The vectors keep their capacity
+// between calls, so a long-lived instance makes lookups allocation-free.
+struct ValidStrata {
+    vector<int> x;
+    vector<int> y;
+};
+
 // Implementation of "Efficient Generation of Points that Satisfy
 // Two-Dimensional Elementary Intervals" by Matt Pharr (2019). Given a set of
 // strata corresponding to all elementary (0,2) intervals, and a set of
-// positions on a square grid, returns the narrowest X strata and Y strata that
-// are unoccupied.
+// positions on a square grid, writes the narrowest X strata and Y strata that
+// are unoccupied to `valid`.
+void GetValidStrata(const int x_pos,
+                    const int y_pos,
+                    const ElementaryStrata& strata,
+                    ValidStrata* valid);
+
 std::pair<std::vector<int>, std::vector<int>>
     GetValidStrata(const int x_pos,
                    const int y_pos,
-                   const std::vector<std::vector<bool>>& strata);
+                   const ElementaryStrata& strata);
 
+// Both walks are depth-first over the unoccupied strata below the starting
+// one, with an explicit stack instead of recursion. Each step halves one side
+// of the stratum, so the stack never holds more than one entry per level plus
+// one, and the leaves come out in increasing order.
+static const int kMaxStrataStack = 64;
 
 void GetXStrata(const int x_pos,
                 const int y_pos,
                 const int strata_index,
-                const vector<vector<bool>>& strata,
+                const ElementaryStrata& strata,
                 vector<int>* x_strata) {
-    const int strata_n_cols = 1 << (strata.size() - strata_index - 1);
-    const bool is_occupied =
-        strata[strata_index][y_pos*strata_n_cols + x_pos];
-
-    if (!is_occupied) {
-        if (strata_index == 0) {
+    int stack_level[kMaxStrataStack];
+    int stack_x[kMaxStrataStack];
+    int top = 0;
+    stack_level[0] = strata_index;
+    stack_x[0] = x_pos;
+    while (top >= 0) {
+        const int level = stack_level[top];
+        const int x = stack_x[top--];
+        const int y = y_pos >> (strata_index - level);
+        const int strata_n_cols = 1 << (strata.size() - level - 1);
+        if (strata.Get(level, y*strata_n_cols + x)) continue;
+        if (level == 0) {
             // We're at the Nx1 leaf.
-            x_strata->push_back(x_pos);
+            x_strata->push_back(x);
         } else {
-            GetXStrata(x_pos * 2, y_pos / 2, strata_index - 1, strata, x_strata);
-            GetXStrata(x_pos * 2 + 1, y_pos / 2, strata_index - 1, strata, x_strata);
+            stack_level[++top] = level - 1;
+            stack_x[top] = x * 2 + 1;
+            stack_level[++top] = level - 1;
+            stack_x[top] = x * 2;
         }
     }
 }
 void GetYStrata(const int x_pos,
                 const int y_pos,
                 const int strata_index,
-                const vector<vector<bool>>& strata,
+                const ElementaryStrata& strata,
                 vector<int>* y_strata) {
-    const int strata_n_cols = 1 << (strata.size() - strata_index - 1);
-    const bool is_occupied =
-        strata[strata_index][y_pos*strata_n_cols + x_pos];
-
-    if (!is_occupied) {
+    int stack_level[kMaxStrataStack];
+    int stack_y[kMaxStrataStack];
+    int top = 0;
+    stack_level[0] = strata_index;
+    stack_y[0] = y_pos;
+    while (top >= 0) {
+        const int level = stack_level[top];
+        const int y = stack_y[top--];
+        const int x = x_pos >> (level - strata_index);
+        const int strata_n_cols = 1 << (strata.size() - level - 1);
+        if (strata.Get(level, y*strata_n_cols + x)) continue;
         if (strata_n_cols == 1) {
             // We're at the 1xN leaf.
-            y_strata->push_back(y_pos);
+            y_strata->push_back(y);
         } else {
-            GetYStrata(x_pos / 2, y_pos * 2, strata_index + 1, strata, y_strata);
-            GetYStrata(x_pos / 2, y_pos * 2 + 1, strata_index + 1, strata, y_strata);
+            stack_level[++top] = level + 1;
+            stack_y[top] = y * 2 + 1;
+            stack_level[++top] = level + 1;
+            stack_y[top] = y * 2;
         }
     }
 }
 
-std::pair<vector<int>, vector<int>> GetValidStrata(
-        const int x_pos, const int y_pos, const vector<vector<bool>>& strata) {
-    std::pair<vector<int>, vector<int>> valid_strata = {{}, {}};
+void GetValidStrata(const int x_pos, const int y_pos,
+                    const ElementaryStrata& strata, ValidStrata* valid) {
+    valid->x.clear();
+    valid->y.clear();
 
     if (strata.size() % 2 == 1) {
-        GetXStrata(x_pos, y_pos, strata.size()/2, strata, &valid_strata.first);
-        GetYStrata(x_pos, y_pos, strata.size()/2, strata, &valid_strata.second);
+        GetXStrata(x_pos, y_pos, strata.size()/2, strata, &valid->x);
+        GetYStrata(x_pos, y_pos, strata.size()/2, strata, &valid->y);
     } else {
-        GetXStrata(x_pos, y_pos/2, strata.size()/2-1, strata, &valid_strata.first);
-        GetYStrata(x_pos/2, y_pos, strata.size()/2, strata, &valid_strata.second);
+        GetXStrata(x_pos, y_pos/2, strata.size()/2-1, strata, &valid->x);
+        GetYStrata(x_pos/2, y_pos, strata.size()/2, strata, &valid->y);
     }
+}
 
-    return valid_strata;
+std::pair<vector<int>, vector<int>> GetValidStrata(
+        const int x_pos, const int y_pos, const ElementaryStrata& strata) {
+    ValidStrata valid;
+    GetValidStrata(x_pos, y_pos, strata, &valid);
+    return {std::move(valid.x), std::move(valid.y)};
 }
 
 }  // namespace pmj
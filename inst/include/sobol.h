@@ -6,6 +6,9 @@
 #include "siphash.h"
 #include <stdexcept>
 #include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 
 static const float FloatOneMinusEpsilon = 0.99999994;
 
@@ -13,6 +16,11 @@ static inline  float u32_to_0_1_f32(uint32_t n) {
   return(std::fmin(n * 0x1p-32f /* 1/2^32 */,
                    FloatOneMinusEpsilon));
 }
+
+// Exact: every 32-bit value is representable in a double, and the result is < 1.
+static inline double u32_to_0_1_f64(uint32_t n) {
+  return(n * 0x1p-32);
+}
 static inline uint32_t hash_combine(uint32_t seed, uint32_t v) {
   return seed ^ (v + (seed << 6) + (seed >> 2));
 }
@@ -121,6 +129,192 @@ static inline float sobol_single(uint32_t index, uint32_t dimension, uint32_t sc
   return(u32_to_0_1_f32(sobol_u32(index, dimension, scramble)));
 }
 
+// Double-precision variants: all 32 bits of the value are kept.
+static inline double sobol_owen_single_f64(uint32_t index, uint32_t dimension, uint32_t seed) {
+  if(dimension >= 21201) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  return(u32_to_0_1_f64(owen_scramble_fast_u32(sobol(owen_scramble_fast_u32(index, seed), dimension),
+                                               hash_combine(seed, dimension))));
+}
+
+static inline double sobol_single_f64(uint32_t index, uint32_t dimension, uint32_t scramble) {
+  return(u32_to_0_1_f64(sobol_u32(index, dimension, scramble)));
+}
+
+//----------------------------------------------------------------------
+// Batch generation
+//
+// Consecutive Sobol points differ by a single direction number when visited
+// in Gray-code order: sobol(g(i+1)) = sobol(g(i)) ^ V[ctz(i+1)], where
+// g(i) = i ^ (i >> 1). The batch generator uses this to produce each value with
+// one XOR instead of a walk over every set bit of the index.
+
+static inline int count_trailing_zeros_u32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+  return(__builtin_ctz(x));
+#else
+  int n = 0;
+  while (!(x & 1)) {
+    x >>= 1;
+    n++;
+  }
+  return(n);
+#endif
+}
+
+static inline uint32_t gray_code_u32(uint32_t i) {
+  return(i ^ (i >> 1));
+}
+
+// Sobol value with no index scrambling.
+static inline uint32_t sobol_unscrambled_u32(uint32_t index, uint32_t dimension) {
+  uint32_t v = 0;
+  for (int i = dimension * SobolMatrixSize; index != 0; index >>= 1, i++) {
+    if (index & 1) {
+      v ^= SobolMatrices32[i];
+    }
+  }
+  return (v);
+}
+
+enum class sobol_order {
+  // Same values, in the same order, as `sobol_u32()`/`sobol_single()`.
+  natural,
+  // Gray-code order of the underlying Sobol index. Each aligned power-of-two
+  // block holds the same points as in natural order, just permuted, and the
+  // index scrambling only changes the order inside such a block, so the output
+  // of this mode does not depend on `scramble`.
+  gray
+};
+
+// Stateful generator for consecutive points of Sobol dimensions
+// [first_dim, first_dim + num_dims). Output is written column-major: value `k`
+// of dimension `first_dim + d` goes to `out[d * stride + k]`. Each call
+// continues where the previous one stopped.
+class sobol_batch_generator {
+public:
+  sobol_batch_generator(uint32_t num_dims, uint32_t scramble = 0,
+                        sobol_order order = sobol_order::natural,
+                        uint32_t first_dim = 0)
+    : num_dims_(num_dims), first_dim_(first_dim), scramble_(scramble), order_(order),
+      values_(num_dims), tile_map_(TileSize), tile_(TileSize) {
+    if((uint64_t)first_dim + num_dims > (uint64_t)NumSobolDimensions) {
+      throw std::runtime_error("Too many dimensions");
+    }
+    seek(0);
+  }
+
+  // Move to sequence index `index`. O(32 * num_dims).
+  void seek(uint32_t index) {
+    index_ = index;
+    if(order_ == sobol_order::gray) {
+      for(uint32_t d = 0; d < num_dims_; d++) {
+        values_[d] = sobol_unscrambled_u32(gray_code_u32(index), first_dim_ + d);
+      }
+    }
+  }
+
+  uint32_t index() const { return index_; }
+  uint32_t num_dims() const { return num_dims_; }
+
+  void generate_u32(uint32_t n, uint32_t* out, size_t stride) {
+    generate_impl(n, out, stride, [](uint32_t v) { return v; });
+  }
+
+  void generate(uint32_t n, float* out, size_t stride) {
+    generate_impl(n, out, stride, u32_to_0_1_f32);
+  }
+
+  void generate(uint32_t n, double* out, size_t stride) {
+    generate_impl(n, out, stride, u32_to_0_1_f64);
+  }
+
+private:
+  // Natural order is produced one aligned tile at a time: index scrambling
+  // maps an aligned power-of-two block onto another aligned block, so a whole
+  // tile of values can be stepped out in Gray-code order and then gathered.
+  static constexpr uint32_t TileSize = 1024;
+
+  template<class T, class Convert>
+  void generate_impl(uint32_t n, T* out, size_t stride, Convert convert) {
+    if(order_ == sobol_order::gray) {
+      uint32_t written = 0;
+      while(written < n) {
+        // Stop where the 32-bit index wraps to 0, whose trailing zero count is
+        // undefined, and restart the values there.
+        const uint32_t count = (uint32_t)std::min<uint64_t>(n - written, (uint64_t(1) << 32) - index_);
+        for(uint32_t d = 0; d < num_dims_; d++) {
+          const uint32_t* matrix = SobolMatrices32 + (first_dim_ + d) * SobolMatrixSize;
+          uint32_t v = values_[d];
+          T* column = out + d * stride + written;
+          for(uint32_t k = 0; k < count; k++) {
+            column[k] = convert(v);
+            const uint32_t next = index_ + k + 1;
+            if(next != 0) {
+              v ^= matrix[count_trailing_zeros_u32(next)];
+            }
+          }
+          values_[d] = v;
+        }
+        written += count;
+        index_ += count;
+        if(index_ == 0) {
+          seek(0);
+        }
+      }
+      return;
+    }
+
+    uint32_t written = 0;
+    while(written < n) {
+      const uint32_t tile_start = index_ & ~(TileSize - 1);
+      const uint32_t offset = index_ - tile_start;
+      const uint32_t count = std::min(n - written, TileSize - offset);
+
+      // A handful of values from a tile are cheaper to compute directly.
+      if(count * 32 < TileSize) {
+        for(uint32_t k = 0; k < count; k++) {
+          const uint32_t scrambled = owen_scramble_fast_u32(index_ + k, scramble_);
+          for(uint32_t d = 0; d < num_dims_; d++) {
+            out[d * stride + written + k] = convert(sobol_unscrambled_u32(scrambled, first_dim_ + d));
+          }
+        }
+      } else {
+        const uint32_t scrambled_tile = owen_scramble_fast_u32(tile_start, scramble_) & ~(TileSize - 1);
+        for(uint32_t k = 0; k < count; k++) {
+          tile_map_[k] = owen_scramble_fast_u32(index_ + k, scramble_) & (TileSize - 1);
+        }
+        for(uint32_t d = 0; d < num_dims_; d++) {
+          const uint32_t* matrix = SobolMatrices32 + (first_dim_ + d) * SobolMatrixSize;
+          uint32_t v = sobol_unscrambled_u32(scrambled_tile, first_dim_ + d);
+          tile_[0] = v;
+          for(uint32_t j = 1; j < TileSize; j++) {
+            v ^= matrix[count_trailing_zeros_u32(j)];
+            tile_[gray_code_u32(j)] = v;
+          }
+          T* column = out + d * stride + written;
+          for(uint32_t k = 0; k < count; k++) {
+            column[k] = convert(tile_[tile_map_[k]]);
+          }
+        }
+      }
+      written += count;
+      index_ += count;
+    }
+  }
+
+  uint32_t num_dims_;
+  uint32_t first_dim_;
+  uint32_t scramble_;
+  sobol_order order_;
+  uint32_t index_ = 0;
+  // Current value of each dimension in Gray-code mode.
+  std::vector<uint32_t> values_;
+  std::vector<uint32_t> tile_map_;
+  std::vector<uint32_t> tile_;
+};
+
 //----------------------------------------------------------------------
 
 } //namespace spacefillr
@@ -0,0 +1,141 @@
+#ifndef SOBOL64H
+#define SOBOL64H
+
+#include "sobol.h"
+#include "sobol_joe_kuo.h"
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// 64-bit Sobol sequences
+//
+// `sobol_u32()` and `sobol_owen_single()` take 32-bit indices and return 32
+// bits per coordinate, so sequences wrap after 2^32 points. The functions below
+// use 64-bit direction numbers generated from the Joe-Kuo parameters in
+// sobol_joe_kuo.h (the same sequences as `SobolMatrices32`), take 64-bit
+// indices and return 64-bit values, of which the top 53 bits are kept for
+// double output. Unscrambled values agree with `SobolMatrices32` in their top
+// 32 bits.
+
+const static int SobolMatrixSize64 = 64;
+
+// Writes the 64 direction numbers of `dimension` to `v`: v[k-1] = m_k * 2^(64-k).
+static inline void sobol_joe_kuo_matrix64(uint32_t dimension, uint64_t* v) {
+  const SobolJoeKuoEntry& entry = SobolJoeKuo[dimension];
+  const int s = entry.degree;
+  std::vector<uint64_t> m(SobolMatrixSize64 + 1, 1);
+  for (int k = 1; k <= s; k++) {
+    m[k] = entry.m[k-1];
+  }
+  if (s > 0) {
+    for (int k = s + 1; k <= SobolMatrixSize64; k++) {
+      uint64_t mk = m[k-s] ^ (m[k-s] << s);
+      for (int j = 1; j < s; j++) {
+        if ((entry.a >> (s - 1 - j)) & 1) {
+          mk ^= m[k-j] << j;
+        }
+      }
+      m[k] = mk;
+    }
+  }
+  for (int k = 1; k <= SobolMatrixSize64; k++) {
+    v[k-1] = m[k] << (SobolMatrixSize64 - k);
+  }
+}
+
+// 64-bit direction numbers for all 1024 dimensions (512 KB), built on first use.
+static inline const uint64_t* sobol_matrices64() {
+  static const std::vector<uint64_t> matrices = []() {
+    std::vector<uint64_t> v((size_t)NumSobolDimensions * SobolMatrixSize64);
+    for (int d = 0; d < NumSobolDimensions; d++) {
+      sobol_joe_kuo_matrix64(d, v.data() + (size_t)d * SobolMatrixSize64);
+    }
+    return v;
+  }();
+  return(matrices.data());
+}
+
+// Keeps the top 53 bits: every result is exactly representable and < 1.
+static inline double u64_to_0_1_f64(uint64_t n) {
+  return((n >> 11) * 0x1p-53);
+}
+
+// Owen scrambling of a 64-bit value, built from the 32-bit hash: the high half
+// is scrambled with `seed`, and the low half with a seed derived from the high
+// input bits. Each output bit still depends only on input bits of equal or
+// higher significance.
+static inline uint64_t owen_scramble_fast_u64(uint64_t x, uint32_t seed) {
+  const uint32_t hi = x >> 32;
+  const uint32_t lo = (uint32_t)x;
+  return(((uint64_t)owen_scramble_fast_u32(hi, seed) << 32) |
+         owen_scramble_fast_u32(lo, hash_u32(hi, seed)));
+}
+
+static inline uint64_t sobol_unscrambled_u64(uint64_t index, uint32_t dimension) {
+  const uint64_t* matrix = sobol_matrices64() + (size_t)dimension * SobolMatrixSize64;
+  uint64_t v = 0;
+  for (int i = 0; index != 0; index >>= 1, i++) {
+    if (index & 1) {
+      v ^= matrix[i];
+    }
+  }
+  return (v);
+}
+
+// 64-bit counterpart of `sobol_u32()`: the index is Owen-scrambled (shuffled)
+// with `scramble` before the matrix multiplication.
+static inline uint64_t sobol_u64(uint64_t index, uint32_t dimension, uint32_t scramble = 0) {
+  if(dimension >= (uint32_t)NumSobolDimensions) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  return(sobol_unscrambled_u64(owen_scramble_fast_u64(index, scramble), dimension));
+}
+
+// 64-bit counterpart of `sobol_owen_single()`: shuffled index, Owen-scrambled value.
+static inline uint64_t sobol_owen_u64(uint64_t index, uint32_t dimension, uint32_t seed) {
+  if(dimension >= (uint32_t)NumSobolDimensions) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  return(owen_scramble_fast_u64(sobol_unscrambled_u64(owen_scramble_fast_u64(index, seed), dimension),
+                                hash_combine(seed, dimension)));
+}
+
+static inline double sobol64_single(uint64_t index, uint32_t dimension, uint32_t scramble) {
+  return(u64_to_0_1_f64(sobol_u64(index, dimension, scramble)));
+}
+
+static inline double sobol64_owen_single(uint64_t index, uint32_t dimension, uint32_t seed) {
+  return(u64_to_0_1_f64(sobol_owen_u64(index, dimension, seed)));
+}
+
+// Owen-scrambled values for indices [start, start + n) of dimensions
+// [0, num_dims), identical to `sobol64_owen_single()`. Output is column-major:
+// value `k` of dimension `d` goes to `out[d * stride + k]`. Each index is
+// shuffled once for all dimensions.
+static inline void sobol64_owen_block(uint64_t start, uint64_t n, uint32_t num_dims,
+                                      uint32_t seed, double* out, size_t stride) {
+  if(num_dims > (uint32_t)NumSobolDimensions) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  const uint64_t* matrices = sobol_matrices64();
+  for(uint64_t k = 0; k < n; k++) {
+    const uint64_t index = owen_scramble_fast_u64(start + k, seed);
+    for(uint32_t d = 0; d < num_dims; d++) {
+      const uint64_t* matrix = matrices + (size_t)d * SobolMatrixSize64;
+      uint64_t v = 0;
+      for (uint64_t i = index; i != 0; i >>= 1, matrix++) {
+        if (i & 1) {
+          v ^= *matrix;
+        }
+      }
+      out[d * stride + k] = u64_to_0_1_f64(owen_scramble_fast_u64(v, hash_combine(seed, d)));
+    }
+  }
+}
+
+} //namespace spacefillr
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef SOBOLLUTH
+#define SOBOLLUTH
+
+#include "sobol.h"
+#include "sobol_simd.h"
+#include <memory>
+#include <vector>
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Byte lookup-table Sobol engine
+//
+// A Sobol value is the XOR of the direction numbers selected by the set bits of
+// the index, which is linear over GF(2): splitting the index into four bytes,
+// the value is the XOR of four partial results, one per byte. Tabulating the
+// 256 partial results of each byte (4 KB per dimension) turns up to 32
+// conditional XORs into 4 lookups. Unlike Gray-code stepping this needs no
+// state, so it suits random-access queries such as per-pixel padded sampling.
+
+static const int SobolLutChunks = 4;
+static const int SobolLutEntries = 256;
+
+// Random-access Sobol values from per-dimension byte tables, built the first
+// time a dimension is used. Lazy building makes the lookups non-const; call
+// `prepare()` for every dimension up front to share one engine between threads
+// through the `const` methods.
+class sobol_lut_engine {
+public:
+  sobol_lut_engine(sobol_directions directions = sobol_directions::matrices32)
+    : directions_(directions),
+      tables_(directions == sobol_directions::matrices32 ? NumSobolDimensions : 21201) {}
+
+  uint32_t max_dims() const { return (uint32_t)tables_.size(); }
+
+  // Builds the tables of dimensions [first_dim, first_dim + num_dims).
+  void prepare(uint32_t first_dim, uint32_t num_dims) {
+    if((uint64_t)first_dim + num_dims > tables_.size()) {
+      throw std::runtime_error("Too many dimensions");
+    }
+    for(uint32_t d = first_dim; d < first_dim + num_dims; d++) {
+      table(d);
+    }
+  }
+
+  bool is_prepared(uint32_t dimension) const {
+    return(dimension < tables_.size() && tables_[dimension] != nullptr);
+  }
+
+  // Sobol value of `index` with no scrambling. `dimension` must be prepared.
+  uint32_t lookup_u32(uint32_t index, uint32_t dimension) const {
+    return(lookup(tables_[dimension].get(), index));
+  }
+
+  uint32_t unscrambled_u32(uint32_t index, uint32_t dimension) {
+    return(lookup(table(dimension), index));
+  }
+
+  // Same as `sobol_u32(index, dimension, scramble)`
+  // (requires `sobol_directions::matrices32`).
+  uint32_t sobol_u32(uint32_t index, uint32_t dimension, uint32_t scramble = 0) {
+    return(unscrambled_u32(owen_scramble_fast_u32(index, scramble), dimension));
+  }
+
+  float sobol_single(uint32_t index, uint32_t dimension, uint32_t scramble) {
+    return(u32_to_0_1_f32(sobol_u32(index, dimension, scramble)));
+  }
+
+  double sobol_single_f64(uint32_t index, uint32_t dimension, uint32_t scramble) {
+    return(u32_to_0_1_f64(sobol_u32(index, dimension, scramble)));
+  }
+
+  // Same as `sobol_owen_single()` before conversion
+  // (requires `sobol_directions::owen`).
+  uint32_t sobol_owen_u32(uint32_t index, uint32_t dimension, uint32_t seed) {
+    return(owen_scramble_fast_u32(unscrambled_u32(owen_scramble_fast_u32(index, seed), dimension),
+                                  hash_combine(seed, dimension)));
+  }
+
+  float sobol_owen_single(uint32_t index, uint32_t dimension, uint32_t seed) {
+    return(u32_to_0_1_f32(sobol_owen_u32(index, dimension, seed)));
+  }
+
+  double sobol_owen_single_f64(uint32_t index, uint32_t dimension, uint32_t seed) {
+    return(u32_to_0_1_f64(sobol_owen_u32(index, dimension, seed)));
+  }
+
+private:
+  static uint32_t lookup(const uint32_t* t, uint32_t index) {
+    return(t[index & 0xff] ^
+           t[SobolLutEntries + ((index >> 8) & 0xff)] ^
+           t[2 * SobolLutEntries + ((index >> 16) & 0xff)] ^
+           t[3 * SobolLutEntries + (index >> 24)]);
+  }
+
+  const uint32_t* table(uint32_t dimension) {
+    if(dimension >= tables_.size()) {
+      throw std::runtime_error("Too many dimensions");
+    }
+    std::unique_ptr<uint32_t[]>& t = tables_[dimension];
+    if(!t) {
+      t.reset(new uint32_t[SobolLutChunks * SobolLutEntries]);
+      for(int c = 0; c < SobolLutChunks; c++) {
+        uint32_t* chunk = t.get() + c * SobolLutEntries;
+        chunk[0] = 0;
+        // Each entry adds its lowest set bit's direction number to an entry
+        // that is already filled in.
+        for(int b = 1; b < SobolLutEntries; b++) {
+          const int bit = c * 8 + count_trailing_zeros_u32(b);
+          chunk[b] = chunk[b & (b - 1)] ^ direction(dimension, bit);
+        }
+      }
+    }
+    return(t.get());
+  }
+
+  uint32_t direction(uint32_t dimension, int bit) const {
+    return(directions_ == sobol_directions::matrices32 ?
+           SobolMatrices32[dimension * SobolMatrixSize + bit] :
+           SPACEFILLR_SOBOL_DIRECTIONS[dimension][bit]);
+  }
+
+  sobol_directions directions_;
+  std::vector<std::unique_ptr<uint32_t[]>> tables_;
+};
+
+} //namespace spacefillr
+
+#endif
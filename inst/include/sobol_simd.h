@@ -0,0 +1,381 @@
+#ifndef SOBOLSIMDH
+#define SOBOLSIMDH
+
+#include "sobol.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPACEFILLR_SOBOL_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+// AArch64 only: vrbitq_u8 doesn't exist on 32-bit ARM, which uses the scalar
+// code instead.
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#define SPACEFILLR_SOBOL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace spacefillr {
+
+//----------------------------------------------------------------------
+// Vectorized multi-dimension Sobol kernel
+//
+// The direction-number tables are stored one dimension after another, so
+// computing many dimensions of one point walks a separate 32-entry column per
+// dimension. The kernel below transposes them so that row `bit` holds that
+// direction number for every dimension contiguously: one set bit of the index
+// then becomes a single vector XOR across 8 (AVX2), 16 (AVX-512) or 4
+// (AArch64 NEON) dimensions. The instruction set is picked at runtime on x86.
+
+typedef void (*sobol_xor_row_fn)(uint32_t* out, const uint32_t* row, size_t n);
+
+static inline void sobol_xor_row_scalar(uint32_t* out, const uint32_t* row, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    out[i] ^= row[i];
+  }
+}
+
+#ifdef SPACEFILLR_SOBOL_X86_DISPATCH
+__attribute__((target("avx2")))
+static void sobol_xor_row_avx2(uint32_t* out, const uint32_t* row, size_t n) {
+  size_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(out + i));
+    __m256i r = _mm256_loadu_si256((const __m256i*)(row + i));
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_xor_si256(v, r));
+  }
+  for(; i < n; i++) {
+    out[i] ^= row[i];
+  }
+}
+
+__attribute__((target("avx512f")))
+static void sobol_xor_row_avx512(uint32_t* out, const uint32_t* row, size_t n) {
+  size_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m512i v = _mm512_loadu_si512((const void*)(out + i));
+    __m512i r = _mm512_loadu_si512((const void*)(row + i));
+    _mm512_storeu_si512((void*)(out + i), _mm512_xor_si512(v, r));
+  }
+  for(; i < n; i++) {
+    out[i] ^= row[i];
+  }
+}
+#endif
+
+#ifdef SPACEFILLR_SOBOL_NEON
+static inline void sobol_xor_row_neon(uint32_t* out, const uint32_t* row, size_t n) {
+  size_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    vst1q_u32(out + i,     veorq_u32(vld1q_u32(out + i),     vld1q_u32(row + i)));
+    vst1q_u32(out + i + 4, veorq_u32(vld1q_u32(out + i + 4), vld1q_u32(row + i + 4)));
+  }
+  for(; i < n; i++) {
+    out[i] ^= row[i];
+  }
+}
+#endif
+
+static inline sobol_xor_row_fn select_sobol_xor_row() {
+#if defined(SPACEFILLR_SOBOL_X86_DISPATCH)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f")) {
+    return(sobol_xor_row_avx512);
+  }
+  if(__builtin_cpu_supports("avx2")) {
+    return(sobol_xor_row_avx2);
+  }
+  return(sobol_xor_row_scalar);
+#elif defined(SPACEFILLR_SOBOL_NEON)
+  return(sobol_xor_row_neon);
+#else
+  return(sobol_xor_row_scalar);
+#endif
+}
+
+// Which direction numbers to use: `SobolMatrices32` (1024 dimensions, used by
+// `sobol_u32()`) or `SPACEFILLR_SOBOL_DIRECTIONS` (21201 dimensions, used by
+// `sobol_owen_single()`).
+enum class sobol_directions {
+  matrices32,
+  owen
+};
+
+// Computes all `num_dims` dimensions of a Sobol point at once. Holds its own
+// dimension-interleaved copy of the direction numbers, so construct it once and
+// reuse it; `const` methods are safe to call from several threads.
+class sobol_point_kernel {
+public:
+  sobol_point_kernel(uint32_t num_dims,
+                     sobol_directions directions = sobol_directions::matrices32)
+    : num_dims_(num_dims),
+      rows_((size_t)32 * num_dims), xor_row_(select_sobol_xor_row()) {
+    const uint32_t max_dims = directions == sobol_directions::matrices32 ? NumSobolDimensions : 21201;
+    if(num_dims > max_dims) {
+      throw std::runtime_error("Too many dimensions");
+    }
+    for(uint32_t d = 0; d < num_dims; d++) {
+      for(uint32_t bit = 0; bit < 32; bit++) {
+        rows_[(size_t)bit * num_dims + d] = directions == sobol_directions::matrices32 ?
+          SobolMatrices32[d * SobolMatrixSize + bit] :
+          SPACEFILLR_SOBOL_DIRECTIONS[d][bit];
+      }
+    }
+  }
+
+  uint32_t num_dims() const { return num_dims_; }
+
+  // Unscrambled Sobol values of `index` for every dimension.
+  void sample_unscrambled_u32(uint32_t index, uint32_t* out) const {
+    std::fill_n(out, num_dims_, 0u);
+    for(const uint32_t* row = rows_.data(); index != 0; index >>= 1, row += num_dims_) {
+      if(index & 1) {
+        xor_row_(out, row, num_dims_);
+      }
+    }
+  }
+
+  // Same as calling `sobol_u32(index, d, scramble)` for every dimension `d`
+  // (requires `sobol_directions::matrices32`).
+  void sample_u32(uint32_t index, uint32_t scramble, uint32_t* out) const {
+    sample_unscrambled_u32(owen_scramble_fast_u32(index, scramble), out);
+  }
+
+  void sample(uint32_t index, uint32_t scramble, float* out) const {
+    sample_chunked(owen_scramble_fast_u32(index, scramble), false, 0, out,
+                   [](uint32_t v) { return u32_to_0_1_f32(v); });
+  }
+
+  void sample(uint32_t index, uint32_t scramble, double* out) const {
+    sample_chunked(owen_scramble_fast_u32(index, scramble), false, 0, out,
+                   [](uint32_t v) { return u32_to_0_1_f64(v); });
+  }
+
+  // Same as calling `sobol_owen_single(index, d, seed)` for every dimension `d`
+  // (requires `sobol_directions::owen`).
+  void sample_owen(uint32_t index, uint32_t seed, float* out) const {
+    sample_chunked(owen_scramble_fast_u32(index, seed), true, seed, out,
+                   [](uint32_t v) { return u32_to_0_1_f32(v); });
+  }
+
+  void sample_owen(uint32_t index, uint32_t seed, double* out) const {
+    sample_chunked(owen_scramble_fast_u32(index, seed), true, seed, out,
+                   [](uint32_t v) { return u32_to_0_1_f64(v); });
+  }
+
+  void sample_owen_u32(uint32_t index, uint32_t seed, uint32_t* out) const {
+    sample_unscrambled_u32(owen_scramble_fast_u32(index, seed), out);
+    for(uint32_t d = 0; d < num_dims_; d++) {
+      out[d] = owen_scramble_fast_u32(out[d], hash_combine(seed, d));
+    }
+  }
+
+private:
+  // Dimensions converted per chunk by the float/double samplers, so that their
+  // integer scratch lives on the stack.
+  static const uint32_t ScratchDims = 256;
+
+  // Unscrambled values of dimensions [first, first + count) of `index`.
+  void sample_unscrambled_range_u32(uint32_t index, uint32_t first, uint32_t count,
+                                    uint32_t* out) const {
+    std::fill_n(out, count, 0u);
+    for(const uint32_t* row = rows_.data() + first; index != 0; index >>= 1, row += num_dims_) {
+      if(index & 1) {
+        xor_row_(out, row, count);
+      }
+    }
+  }
+
+  // Converts the values of the (already scrambled) `index`, Owen-scrambled per
+  // dimension with `seed` if `owen` is set, with `convert`.
+  template<class T, class Convert>
+  void sample_chunked(uint32_t index, bool owen, uint32_t seed, T* out, Convert convert) const {
+    uint32_t vals[ScratchDims];
+    for(uint32_t first = 0; first < num_dims_; first += ScratchDims) {
+      const uint32_t count = std::min(ScratchDims, num_dims_ - first);
+      sample_unscrambled_range_u32(index, first, count, vals);
+      for(uint32_t k = 0; k < count; k++) {
+        const uint32_t v = owen ? owen_scramble_fast_u32(vals[k], hash_combine(seed, first + k)) : vals[k];
+        out[first + k] = convert(v);
+      }
+    }
+  }
+
+  uint32_t num_dims_;
+  // rows_[bit * num_dims_ + d] is direction number `bit` of dimension `d`.
+  std::vector<uint32_t> rows_;
+  sobol_xor_row_fn xor_row_;
+};
+
+//----------------------------------------------------------------------
+// Vectorized Owen scrambling
+//
+// `owen_scramble_fast_u32()` applied to a block of values with one seed. The
+// seed hash is done once per block, and the lanes run the Laine-Karras style
+// hash in parallel. `reverse_bits` becomes two byte shuffles: one reverses the
+// bytes of each 32-bit lane, the other reverses the bits inside each byte with
+// a 16-entry nibble table.
+
+typedef void (*owen_scramble_block_fn)(const uint32_t* in, uint32_t* out,
+                                       size_t n, uint32_t hashed_seed);
+
+static inline uint32_t owen_scramble_hashed_seed(uint32_t seed) {
+  return(hash_u32(seed, 0xa14a177d));
+}
+
+// `owen_scramble_fast_u32()` with the seed already passed through
+// `owen_scramble_hashed_seed()`.
+static inline uint32_t owen_scramble_fast_u32_hashed(uint32_t x, uint32_t seed) {
+  x = reverse_bits(x);
+  x ^= x * 0x3d20adea;
+  x += seed;
+  x *= (seed >> 16) | 1;
+  x ^= x * 0x05526c56;
+  x ^= x * 0x53a22864;
+  return(reverse_bits(x));
+}
+
+static inline void owen_scramble_block_scalar(const uint32_t* in, uint32_t* out,
+                                              size_t n, uint32_t hashed_seed) {
+  for(size_t i = 0; i < n; i++) {
+    out[i] = owen_scramble_fast_u32_hashed(in[i], hashed_seed);
+  }
+}
+
+#ifdef SPACEFILLR_SOBOL_X86_DISPATCH
+__attribute__((target("avx2")))
+static inline __m256i reverse_bits_avx2(__m256i x) {
+  const __m256i byte_reverse = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  // Bit-reversed nibbles, and the same shifted into the high nibble.
+  const __m256i rev_lo = _mm256_setr_epi8(0x00, (char)0x80, 0x40, (char)0xc0, 0x20, (char)0xa0, 0x60, (char)0xe0,
+                                          0x10, (char)0x90, 0x50, (char)0xd0, 0x30, (char)0xb0, 0x70, (char)0xf0,
+                                          0x00, (char)0x80, 0x40, (char)0xc0, 0x20, (char)0xa0, 0x60, (char)0xe0,
+                                          0x10, (char)0x90, 0x50, (char)0xd0, 0x30, (char)0xb0, 0x70, (char)0xf0);
+  const __m256i rev_hi = _mm256_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                          0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf,
+                                          0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                          0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  x = _mm256_shuffle_epi8(x, byte_reverse);
+  __m256i lo = _mm256_and_si256(x, nibble);
+  __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+  return(_mm256_or_si256(_mm256_shuffle_epi8(rev_lo, lo), _mm256_shuffle_epi8(rev_hi, hi)));
+}
+
+__attribute__((target("avx2")))
+static void owen_scramble_block_avx2(const uint32_t* in, uint32_t* out,
+                                     size_t n, uint32_t hashed_seed) {
+  const __m256i c0 = _mm256_set1_epi32(0x3d20adea);
+  const __m256i add = _mm256_set1_epi32(hashed_seed);
+  const __m256i mul = _mm256_set1_epi32((hashed_seed >> 16) | 1);
+  const __m256i c1 = _mm256_set1_epi32(0x05526c56);
+  const __m256i c2 = _mm256_set1_epi32(0x53a22864);
+  size_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m256i x = reverse_bits_avx2(_mm256_loadu_si256((const __m256i*)(in + i)));
+    x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, c0));
+    x = _mm256_add_epi32(x, add);
+    x = _mm256_mullo_epi32(x, mul);
+    x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, c1));
+    x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, c2));
+    _mm256_storeu_si256((__m256i*)(out + i), reverse_bits_avx2(x));
+  }
+  for(; i < n; i++) {
+    out[i] = owen_scramble_fast_u32_hashed(in[i], hashed_seed);
+  }
+}
+#endif
+
+#ifdef SPACEFILLR_SOBOL_NEON
+static inline uint32x4_t reverse_bits_neon(uint32x4_t x) {
+  return(vreinterpretq_u32_u8(vrbitq_u8(vrev32q_u8(vreinterpretq_u8_u32(x)))));
+}
+
+static inline void owen_scramble_block_neon(const uint32_t* in, uint32_t* out,
+                                            size_t n, uint32_t hashed_seed) {
+  const uint32x4_t add = vdupq_n_u32(hashed_seed);
+  const uint32x4_t mul = vdupq_n_u32((hashed_seed >> 16) | 1);
+  size_t i = 0;
+  for(; i + 4 <= n; i += 4) {
+    uint32x4_t x = reverse_bits_neon(vld1q_u32(in + i));
+    x = veorq_u32(x, vmulq_n_u32(x, 0x3d20adea));
+    x = vaddq_u32(x, add);
+    x = vmulq_u32(x, mul);
+    x = veorq_u32(x, vmulq_n_u32(x, 0x05526c56));
+    x = veorq_u32(x, vmulq_n_u32(x, 0x53a22864));
+    vst1q_u32(out + i, reverse_bits_neon(x));
+  }
+  for(; i < n; i++) {
+    out[i] = owen_scramble_fast_u32_hashed(in[i], hashed_seed);
+  }
+}
+#endif
+
+static inline owen_scramble_block_fn select_owen_scramble_block() {
+#if defined(SPACEFILLR_SOBOL_X86_DISPATCH)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx2")) {
+    return(owen_scramble_block_avx2);
+  }
+  return(owen_scramble_block_scalar);
+#elif defined(SPACEFILLR_SOBOL_NEON)
+  return(owen_scramble_block_neon);
+#else
+  return(owen_scramble_block_scalar);
+#endif
+}
+
+// Same as `out[i] = owen_scramble_fast_u32(in[i], seed)` for `i < n`. `in` and
+// `out` may be the same buffer.
+static inline void owen_scramble_fast_block_u32(const uint32_t* in, uint32_t* out,
+                                                size_t n, uint32_t seed) {
+  static const owen_scramble_block_fn scramble_block = select_owen_scramble_block();
+  scramble_block(in, out, n, owen_scramble_hashed_seed(seed));
+}
+
+template<class T> static inline T sobol_to_unit_interval(uint32_t v);
+template<> inline float sobol_to_unit_interval<float>(uint32_t v) { return(u32_to_0_1_f32(v)); }
+template<> inline double sobol_to_unit_interval<double>(uint32_t v) { return(u32_to_0_1_f64(v)); }
+
+// Owen-scrambled Sobol values for indices [start, start + n) of dimensions
+// [first_dim, first_dim + num_dims), identical to `sobol_owen_single()` for
+// float output and `sobol_owen_single_f64()` for double output. Output
+// is column-major: value `k` of dimension `first_dim + d` goes to
+// `out[d * stride + k]`. The index scramble is shared by every dimension, so it
+// is done once per block of indices.
+template<class T>
+static inline void sobol_owen_block(uint32_t start, uint32_t n, uint32_t num_dims,
+                                    uint32_t seed, T* out, size_t stride,
+                                    uint32_t first_dim = 0) {
+  if((uint64_t)first_dim + num_dims > 21201) {
+    throw std::runtime_error("Too many dimensions");
+  }
+  const size_t BlockSize = 256;
+  uint32_t scrambled_index[BlockSize];
+  uint32_t vals[BlockSize];
+  for(uint32_t block = 0; block < n; block += BlockSize) {
+    const uint32_t count = std::min((uint32_t)BlockSize, n - block);
+    for(uint32_t k = 0; k < count; k++) {
+      scrambled_index[k] = start + block + k;
+    }
+    owen_scramble_fast_block_u32(scrambled_index, scrambled_index, count, seed);
+    for(uint32_t d = 0; d < num_dims; d++) {
+      for(uint32_t k = 0; k < count; k++) {
+        vals[k] = sobol(scrambled_index[k], first_dim + d);
+      }
+      owen_scramble_fast_block_u32(vals, vals, count, hash_combine(seed, first_dim + d));
+      T* column = out + d * stride + block;
+      for(uint32_t k = 0; k < count; k++) {
+        column[k] = sobol_to_unit_interval<T>(vals[k]);
+      }
+    }
+  }
+}
+
+} //namespace spacefillr
+
+#endif
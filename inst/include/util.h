@@ -8,9 +8,13 @@
 #ifndef SAMPLE_GENERATION_UTIL_H_
 #define SAMPLE_GENERATION_UTIL_H_
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,6 +24,12 @@ namespace pmj {
 
 static constexpr int kBestCandidateSamples = 100;
 
+// In adaptive mode the first kAdaptiveFullCandidateSamples points get every
+// candidate, after which the count halves each time the number of points
+// quadruples, down to kMinAdaptiveCandidates.
+static constexpr int kAdaptiveFullCandidateSamples = 1024;
+static constexpr int kMinAdaptiveCandidates = 8;
+
 typedef struct {
   double x;
   double y;
@@ -37,6 +47,24 @@ Point GetBestCandidateOfSamples(const std::vector<Point>& candidates,
                                 const Point* sample_grid[],
                                 const int dim);
 
+// Number of best-candidate samples for the point at `sample_index`, for a
+// requested `num_candidates` per point.
+int GetCandidateCount(const int num_candidates,
+                      const bool adaptive,
+                      const int sample_index);
+
+// Smallest toroidal distance between any two of the points, a measure of
+// blue-noise quality. Works for any point set in [0,1)^2.
+double GetMinimumDistance(const Point points[], const int num_points);
+
+// Writes the points to separate x and y arrays (structure of arrays), e.g.
+// float buffers for SIMD code or the columns of an R matrix. Float values are
+// rounded toward zero, which keeps them below 1 and in the same (dyadic)
+// strata as the doubles. The generators themselves need the Point array (their
+// strata and best-candidate grids point into it), so this is a separate copy.
+template <typename T>
+void SplitPoints(const Point points[], const int num_points, T x[], T y[]);
+
 // Given a sequence of PMJ02 points, this will shuffle them, while the resulting
 // shuffle will still be a progressive (0,2) sequence. We don't actually use it
 // anywhere, this is just to show how easy it is.
@@ -157,31 +185,229 @@ double GetNearestNeighborDistSq(const Point& sample,
   return min_dist_sq;
 }
 
-Point GetBestCandidateOfSamples(const std::vector<Point>& candidates,
-                                const Point* sample_grid[],
-                                const int dim) {
-  // Hypothetically, it could be faster to search all the points in parallel,
-  // culling points as we go, but a naive implementation of this was only a tiny
-  // bit faster, and the code was uglier, so we'll leave it for now.
-  Point best_candidate;
+// Scans candidates [begin, end) and returns the index of the first one with
+// the largest nearest-neighbor distance (or -1 if none is above zero), writing
+// that distance to `best_dist_sq`. A candidate is only searched until it can't
+// beat the best one so far.
+inline int GetBestCandidateInRange(const Point candidates[],
+                                   const int begin,
+                                   const int end,
+                                   const Point* sample_grid[],
+                                   const int dim,
+                                   double* best_dist_sq) {
+  int best_index = -1;
   double max_min_dist_sq = 0.0;
 
-  for (size_t i = 0; i < candidates.size(); i++) {
-    Point cand_sample = candidates[i];
+  for (int i = begin; i < end; i++) {
     double dist_sq =
-      GetNearestNeighborDistSq(cand_sample,
+      GetNearestNeighborDistSq(candidates[i],
                                sample_grid,
                                dim,
                                max_min_dist_sq);
     if (dist_sq > max_min_dist_sq) {
-      best_candidate = cand_sample;
+      best_index = i;
       max_min_dist_sq = dist_sq;
     }
   }
 
+  *best_dist_sq = max_min_dist_sq;
+  return best_index;
+}
+
+Point GetBestCandidateOfSamples(const std::vector<Point>& candidates,
+                                const Point* sample_grid[],
+                                const int dim) {
+  // Hypothetically, it could be faster to search all the points in parallel,
+  // culling points as we go, but a naive implementation of this was only a tiny
+  // bit faster, and the code was uglier, so we'll leave it for now.
+  Point best_candidate;
+  double max_min_dist_sq;
+  const int best_index = GetBestCandidateInRange(
+    candidates.data(), 0, candidates.size(), sample_grid, dim, &max_min_dist_sq);
+  if (best_index >= 0) {
+    best_candidate = candidates[best_index];
+  }
+
   return best_candidate;
 }
 
+int GetCandidateCount(const int num_candidates,
+                      const bool adaptive,
+                      const int sample_index) {
+  if (!adaptive) return num_candidates;
+  int count = num_candidates;
+  for (long long n = kAdaptiveFullCandidateSamples;
+       n <= sample_index && count > kMinAdaptiveCandidates;
+       n *= 4) {
+    count = std::max(count / 2, kMinAdaptiveCandidates);
+  }
+  return count;
+}
+
+double GetMinimumDistance(const Point points[], const int num_points) {
+  if (num_points < 2) return 0.0;
+  // Bucket the points into a grid of about one point per cell, stored as
+  // offsets into a list of point indices sorted by cell.
+  int dim = 1;
+  while (static_cast<long long>(dim) * dim * 4 <= num_points) dim *= 2;
+  // Coordinates outside [0, 1), including NaN, are clamped to the border
+  // cells so that they can't index past the grid.
+  auto grid_pos = [dim](double v) {
+    if (!(v > 0.0)) return 0;
+    if (v >= 1.0) return dim - 1;
+    return std::min(static_cast<int>(v * dim), dim - 1);
+  };
+  auto cell_of = [dim, grid_pos](const Point& p) {
+    return grid_pos(p.y) * dim + grid_pos(p.x);
+  };
+  std::vector<int> cell_start(dim * dim + 1, 0);
+  for (int i = 0; i < num_points; i++) cell_start[cell_of(points[i]) + 1]++;
+  for (int c = 0; c < dim * dim; c++) cell_start[c + 1] += cell_start[c];
+  std::vector<int> cell_points(num_points);
+  std::vector<int> fill(cell_start.begin(), cell_start.end() - 1);
+  for (int i = 0; i < num_points; i++) cell_points[fill[cell_of(points[i])]++] = i;
+
+  const double grid_size = 1.0 / dim;
+  double min_dist_sq = 2.0;
+  for (int i = 0; i < num_points; i++) {
+    const int x_pos = grid_pos(points[i].x);
+    const int y_pos = grid_pos(points[i].y);
+    // Rings of cells around the point's own cell. Points outside ring r are
+    // at least r cells away, so stop once nothing further can be nearer.
+    for (int r = 0; r <= dim / 2; r++) {
+      if (r > 0) {
+        const double ring_dist = (r - 1) * grid_size;
+        if (ring_dist * ring_dist >= min_dist_sq) break;
+      }
+      for (int y = y_pos - r; y <= y_pos + r; y++) {
+        const int x_step = (y == y_pos - r || y == y_pos + r) ? 1 : 2 * r;
+        for (int x = x_pos - r; x <= x_pos + r; x += std::max(x_step, 1)) {
+          const int cell = WrapIndex(y, dim) * dim + WrapIndex(x, dim);
+          for (int k = cell_start[cell]; k < cell_start[cell + 1]; k++) {
+            const int j = cell_points[k];
+            if (j != i) UpdateMinDistSq(points[i], points[j], &min_dist_sq);
+          }
+        }
+      }
+    }
+  }
+  return std::sqrt(min_dist_sq);
+}
+
+/*
+ * Evaluates the candidates of GetBestCandidateOfSamples on several threads.
+ * The candidates are split into one contiguous chunk per thread, each chunk
+ * finds its own best candidate, and the chunk results are combined in order
+ * keeping the first maximum. That is exactly the candidate the sequential scan
+ * picks, so the output doesn't depend on the number of threads.
+ *
+ * One best-candidate search is only tens of microseconds of work, too little
+ * to wake sleeping threads for, so the workers spin (yielding) while waiting
+ * for the next search. They only exist for the lifetime of the evaluator,
+ * i.e. of one call to generate a sequence.
+ */
+class BestCandidateEvaluator {
+  public:
+    // Spinning workers only help with a core each, so the thread count is
+    // capped at the hardware concurrency.
+    explicit BestCandidateEvaluator(const int num_threads)
+      : num_threads_(std::max(1, std::min<int>(
+          num_threads, std::max(1u, std::thread::hardware_concurrency())))),
+        results_(num_threads_) {
+      for (int t = 1; t < num_threads_; t++) {
+        workers_.emplace_back([this, t]() { WorkerLoop(t); });
+      }
+    }
+
+    ~BestCandidateEvaluator() {
+      stop_.store(true, std::memory_order_relaxed);
+      generation_.fetch_add(1, std::memory_order_release);
+      for (auto& worker : workers_) {
+        worker.join();
+      }
+    }
+
+    BestCandidateEvaluator(const BestCandidateEvaluator&) = delete;
+    BestCandidateEvaluator& operator=(const BestCandidateEvaluator&) = delete;
+
+    int num_threads() const { return num_threads_; }
+
+    Point GetBestCandidateOfSamples(const std::vector<Point>& candidates,
+                                    const Point* sample_grid[],
+                                    const int dim) {
+      if (num_threads_ == 1) {
+        return pmj::GetBestCandidateOfSamples(candidates, sample_grid, dim);
+      }
+      candidates_ = candidates.data();
+      num_candidates_ = candidates.size();
+      sample_grid_ = sample_grid;
+      dim_ = dim;
+      pending_.store(num_threads_ - 1, std::memory_order_relaxed);
+      generation_.fetch_add(1, std::memory_order_release);
+
+      RunChunk(0);
+      for (int spins = 0; pending_.load(std::memory_order_acquire) != 0; spins++) {
+        if (spins > kSpinsBeforeYield) std::this_thread::yield();
+      }
+
+      Point best_candidate;
+      double max_min_dist_sq = 0.0;
+      for (int t = 0; t < num_threads_; t++) {
+        if (results_[t].index >= 0 && results_[t].dist_sq > max_min_dist_sq) {
+          best_candidate = candidates[results_[t].index];
+          max_min_dist_sq = results_[t].dist_sq;
+        }
+      }
+      return best_candidate;
+    }
+
+  private:
+    static constexpr int kSpinsBeforeYield = 1024;
+
+    // Each thread's result is on its own cache line.
+    struct alignas(64) ChunkResult {
+      int index;
+      double dist_sq;
+    };
+
+    void RunChunk(const int t) {
+      const int begin = static_cast<long long>(num_candidates_) * t / num_threads_;
+      const int end = static_cast<long long>(num_candidates_) * (t + 1) / num_threads_;
+      results_[t].index = GetBestCandidateInRange(
+        candidates_, begin, end, sample_grid_, dim_, &results_[t].dist_sq);
+    }
+
+    void WorkerLoop(const int t) {
+      unsigned int seen = 0;
+      while (true) {
+        unsigned int generation;
+        for (int spins = 0;
+             (generation = generation_.load(std::memory_order_acquire)) == seen;
+             spins++) {
+          if (spins > kSpinsBeforeYield) std::this_thread::yield();
+        }
+        seen = generation;
+        if (stop_.load(std::memory_order_relaxed)) return;
+        RunChunk(t);
+        pending_.fetch_sub(1, std::memory_order_release);
+      }
+    }
+
+    const int num_threads_;
+    std::vector<ChunkResult> results_;
+    std::vector<std::thread> workers_;
+
+    // The current search, published by incrementing generation_.
+    const Point* candidates_ = nullptr;
+    int num_candidates_ = 0;
+    const Point** sample_grid_ = nullptr;
+    int dim_ = 1;
+
+    std::atomic<unsigned int> generation_{0};
+    std::atomic<int> pending_{0};
+    std::atomic<bool> stop_{false};
+};
+
 /*
  * This is kind of like a binary tree shuffle. Easy to think about for 4 points.
  * We can swap points 1 and 2, and we can swap 3 and 4, and we can swap the
@@ -234,6 +460,26 @@ std::vector<const Point*> ShufflePMJ02SequenceXor(const pmj::Point points[],
   return shuffled_points;
 }
 
+inline double RoundCoordinate(const double value, double) {
+  return value;
+}
+
+inline float RoundCoordinate(const double value, float) {
+  float rounded = static_cast<float>(value);
+  if (rounded > value) {
+    rounded = std::nextafter(rounded, 0.0f);
+  }
+  return rounded;
+}
+
+template <typename T>
+void SplitPoints(const Point points[], const int num_points, T x[], T y[]) {
+  for (int i = 0; i < num_points; i++) {
+    x[i] = RoundCoordinate(points[i].x, T());
+    y[i] = RoundCoordinate(points[i].y, T());
+  }
+}
+
 std::unique_ptr<Point[]> GetUniformRandomSamples(const int num_samples, random_gen& rng) {
   auto samples = std::unique_ptr<Point[]>(new Point[num_samples]());
 
@@ -11,28 +11,30 @@ Rcpp::Rostream<false>& Rcpp::Rcerr = Rcpp::Rcpp_cerr_get();
 #endif
 
 // rcpp_generate_sobol_set
-List rcpp_generate_sobol_set(uint64_t N, unsigned int dim, unsigned int scramble);
-RcppExport SEXP _spacefillr_rcpp_generate_sobol_set(SEXP NSEXP, SEXP dimSEXP, SEXP scrambleSEXP) {
+NumericMatrix rcpp_generate_sobol_set(uint64_t N, unsigned int dim, unsigned int scramble, unsigned int threads);
+RcppExport SEXP _spacefillr_rcpp_generate_sobol_set(SEXP NSEXP, SEXP dimSEXP, SEXP scrambleSEXP, SEXP threadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type dim(dimSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type scramble(scrambleSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_sobol_set(N, dim, scramble));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_sobol_set(N, dim, scramble, threads));
     return rcpp_result_gen;
 END_RCPP
 }
 // rcpp_generate_sobol_owen_set
-List rcpp_generate_sobol_owen_set(uint64_t N, unsigned int dim, unsigned int scramble);
-RcppExport SEXP _spacefillr_rcpp_generate_sobol_owen_set(SEXP NSEXP, SEXP dimSEXP, SEXP scrambleSEXP) {
+NumericMatrix rcpp_generate_sobol_owen_set(uint64_t N, unsigned int dim, unsigned int scramble, unsigned int threads);
+RcppExport SEXP _spacefillr_rcpp_generate_sobol_owen_set(SEXP NSEXP, SEXP dimSEXP, SEXP scrambleSEXP, SEXP threadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type dim(dimSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type scramble(scrambleSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_sobol_owen_set(N, dim, scramble));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_sobol_owen_set(N, dim, scramble, threads));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -50,27 +52,29 @@ BEGIN_RCPP
 END_RCPP
 }
 // rcpp_generate_halton_faure_set
-List rcpp_generate_halton_faure_set(uint64_t N, unsigned int dim);
-RcppExport SEXP _spacefillr_rcpp_generate_halton_faure_set(SEXP NSEXP, SEXP dimSEXP) {
+NumericMatrix rcpp_generate_halton_faure_set(uint64_t N, unsigned int dim, unsigned int threads);
+RcppExport SEXP _spacefillr_rcpp_generate_halton_faure_set(SEXP NSEXP, SEXP dimSEXP, SEXP threadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type dim(dimSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_halton_faure_set(N, dim));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_halton_faure_set(N, dim, threads));
     return rcpp_result_gen;
 END_RCPP
 }
 // rcpp_generate_halton_random_set
-List rcpp_generate_halton_random_set(uint64_t N, unsigned int dim, unsigned int seed);
-RcppExport SEXP _spacefillr_rcpp_generate_halton_random_set(SEXP NSEXP, SEXP dimSEXP, SEXP seedSEXP) {
+NumericMatrix rcpp_generate_halton_random_set(uint64_t N, unsigned int dim, unsigned int seed, unsigned int threads);
+RcppExport SEXP _spacefillr_rcpp_generate_halton_random_set(SEXP NSEXP, SEXP dimSEXP, SEXP seedSEXP, SEXP threadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type dim(dimSEXP);
     Rcpp::traits::input_parameter< unsigned int >::type seed(seedSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_halton_random_set(N, dim, seed));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_halton_random_set(N, dim, seed, threads));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -99,8 +103,33 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// rcpp_create_halton_sampler
+SEXP rcpp_create_halton_sampler(bool faure, unsigned int seed);
+RcppExport SEXP _spacefillr_rcpp_create_halton_sampler(SEXP faureSEXP, SEXP seedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< bool >::type faure(faureSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type seed(seedSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_create_halton_sampler(faure, seed));
+    return rcpp_result_gen;
+END_RCPP
+}
+// rcpp_generate_halton_sampler_single
+double rcpp_generate_halton_sampler_single(SEXP sampler, uint64_t i, unsigned int dim);
+RcppExport SEXP _spacefillr_rcpp_generate_halton_sampler_single(SEXP samplerSEXP, SEXP iSEXP, SEXP dimSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type sampler(samplerSEXP);
+    Rcpp::traits::input_parameter< uint64_t >::type i(iSEXP);
+    Rcpp::traits::input_parameter< unsigned int >::type dim(dimSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_halton_sampler_single(sampler, i, dim));
+    return rcpp_result_gen;
+END_RCPP
+}
 // rcpp_generate_pj_set
-List rcpp_generate_pj_set(uint64_t N, int seed);
+NumericMatrix rcpp_generate_pj_set(uint64_t N, int seed);
 RcppExport SEXP _spacefillr_rcpp_generate_pj_set(SEXP NSEXP, SEXP seedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -112,7 +141,7 @@ BEGIN_RCPP
 END_RCPP
 }
 // rcpp_generate_pmj_set
-List rcpp_generate_pmj_set(uint64_t N, int seed);
+NumericMatrix rcpp_generate_pmj_set(uint64_t N, int seed);
 RcppExport SEXP _spacefillr_rcpp_generate_pmj_set(SEXP NSEXP, SEXP seedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -124,19 +153,22 @@ BEGIN_RCPP
 END_RCPP
 }
 // rcpp_generate_pmjbn_set
-List rcpp_generate_pmjbn_set(uint64_t N, int seed);
-RcppExport SEXP _spacefillr_rcpp_generate_pmjbn_set(SEXP NSEXP, SEXP seedSEXP) {
+NumericMatrix rcpp_generate_pmjbn_set(uint64_t N, int seed, unsigned int threads, int candidates, bool adaptive);
+RcppExport SEXP _spacefillr_rcpp_generate_pmjbn_set(SEXP NSEXP, SEXP seedSEXP, SEXP threadsSEXP, SEXP candidatesSEXP, SEXP adaptiveSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_pmjbn_set(N, seed));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type candidates(candidatesSEXP);
+    Rcpp::traits::input_parameter< bool >::type adaptive(adaptiveSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_pmjbn_set(N, seed, threads, candidates, adaptive));
     return rcpp_result_gen;
 END_RCPP
 }
 // rcpp_generate_pmj02_set
-List rcpp_generate_pmj02_set(uint64_t N, int seed);
+NumericMatrix rcpp_generate_pmj02_set(uint64_t N, int seed);
 RcppExport SEXP _spacefillr_rcpp_generate_pmj02_set(SEXP NSEXP, SEXP seedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
@@ -148,31 +180,48 @@ BEGIN_RCPP
 END_RCPP
 }
 // rcpp_generate_pmj02bn_set
-List rcpp_generate_pmj02bn_set(uint64_t N, int seed);
-RcppExport SEXP _spacefillr_rcpp_generate_pmj02bn_set(SEXP NSEXP, SEXP seedSEXP) {
+NumericMatrix rcpp_generate_pmj02bn_set(uint64_t N, int seed, unsigned int threads, int candidates, bool adaptive);
+RcppExport SEXP _spacefillr_rcpp_generate_pmj02bn_set(SEXP NSEXP, SEXP seedSEXP, SEXP threadsSEXP, SEXP candidatesSEXP, SEXP adaptiveSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< uint64_t >::type N(NSEXP);
     Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
-    rcpp_result_gen = Rcpp::wrap(rcpp_generate_pmj02bn_set(N, seed));
+    Rcpp::traits::input_parameter< unsigned int >::type threads(threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type candidates(candidatesSEXP);
+    Rcpp::traits::input_parameter< bool >::type adaptive(adaptiveSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_generate_pmj02bn_set(N, seed, threads, candidates, adaptive));
+    return rcpp_result_gen;
+END_RCPP
+}
+// rcpp_calculate_min_distance
+double rcpp_calculate_min_distance(NumericMatrix points);
+RcppExport SEXP _spacefillr_rcpp_calculate_min_distance(SEXP pointsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type points(pointsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rcpp_calculate_min_distance(points));
     return rcpp_result_gen;
 END_RCPP
 }
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_spacefillr_rcpp_generate_sobol_set", (DL_FUNC) &_spacefillr_rcpp_generate_sobol_set, 3},
-    {"_spacefillr_rcpp_generate_sobol_owen_set", (DL_FUNC) &_spacefillr_rcpp_generate_sobol_owen_set, 3},
+    {"_spacefillr_rcpp_generate_sobol_set", (DL_FUNC) &_spacefillr_rcpp_generate_sobol_set, 4},
+    {"_spacefillr_rcpp_generate_sobol_owen_set", (DL_FUNC) &_spacefillr_rcpp_generate_sobol_owen_set, 4},
     {"_spacefillr_rcpp_generate_sobol_owen_single", (DL_FUNC) &_spacefillr_rcpp_generate_sobol_owen_single, 3},
-    {"_spacefillr_rcpp_generate_halton_faure_set", (DL_FUNC) &_spacefillr_rcpp_generate_halton_faure_set, 2},
-    {"_spacefillr_rcpp_generate_halton_random_set", (DL_FUNC) &_spacefillr_rcpp_generate_halton_random_set, 3},
+    {"_spacefillr_rcpp_generate_halton_faure_set", (DL_FUNC) &_spacefillr_rcpp_generate_halton_faure_set, 3},
+    {"_spacefillr_rcpp_generate_halton_random_set", (DL_FUNC) &_spacefillr_rcpp_generate_halton_random_set, 4},
     {"_spacefillr_rcpp_generate_halton_faure_single", (DL_FUNC) &_spacefillr_rcpp_generate_halton_faure_single, 2},
     {"_spacefillr_rcpp_generate_halton_random_single", (DL_FUNC) &_spacefillr_rcpp_generate_halton_random_single, 3},
+    {"_spacefillr_rcpp_create_halton_sampler", (DL_FUNC) &_spacefillr_rcpp_create_halton_sampler, 2},
+    {"_spacefillr_rcpp_generate_halton_sampler_single", (DL_FUNC) &_spacefillr_rcpp_generate_halton_sampler_single, 3},
     {"_spacefillr_rcpp_generate_pj_set", (DL_FUNC) &_spacefillr_rcpp_generate_pj_set, 2},
     {"_spacefillr_rcpp_generate_pmj_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmj_set, 2},
-    {"_spacefillr_rcpp_generate_pmjbn_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmjbn_set, 2},
+    {"_spacefillr_rcpp_generate_pmjbn_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmjbn_set, 5},
     {"_spacefillr_rcpp_generate_pmj02_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmj02_set, 2},
-    {"_spacefillr_rcpp_generate_pmj02bn_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmj02bn_set, 2},
+    {"_spacefillr_rcpp_generate_pmj02bn_set", (DL_FUNC) &_spacefillr_rcpp_generate_pmj02bn_set, 5},
+    {"_spacefillr_rcpp_calculate_min_distance", (DL_FUNC) &_spacefillr_rcpp_calculate_min_distance, 1},
     {NULL, NULL, 0}
 };
 
@@ -1,4 +1,6 @@
 #include <Rcpp.h>
+#include <climits>
+#include <stdexcept>
 using namespace Rcpp;
 
 #include "util.h"
@@ -6,163 +8,177 @@ using namespace Rcpp;
 #include "pmj.h"
 #include "pmj02.h"
 #include "sobol.h"
+#include "sobol_simd.h"
+#include "parallel_sets.h"
 #include "halton_sampler.h"
+#include "halton_engine.h"
 #include "samplerBlueNoise.h"
 
 #include "rng.h"
 
-// [[Rcpp::export]]
-List rcpp_generate_sobol_set(uint64_t  N, unsigned int dim, unsigned int scramble) {
-  List final_set(N*dim);
-  int counter = 0;
-  for(unsigned int j = 0; j < dim; j++) {
-    for(uint64_t i = 0; i < N; i++) {
-      final_set(counter) = spacefillr::sobol_single(i, j, scramble);
-      counter = counter + 1;
-    }
+// The sets are returned as R matrices, which have at most INT_MAX rows.
+static void check_set_rows(uint64_t N) {
+  if(N > (uint64_t)INT_MAX) {
+    throw std::runtime_error("Sets have at most 2^31 - 1 points, the maximum number of rows of an R matrix");
   }
+}
+
+// [[Rcpp::export]]
+NumericMatrix rcpp_generate_sobol_set(uint64_t  N, unsigned int dim, unsigned int scramble,
+                                      unsigned int threads) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, dim);
+  spacefillr::generate_sobol_set(N, dim, scramble, final_set.begin(), threads);
   return(final_set);
 }
 
 // [[Rcpp::export]]
-List rcpp_generate_sobol_owen_set(uint64_t  N, unsigned int dim, unsigned int scramble) {
-  List final_set(N*dim);
-  int counter = 0;
-  for(unsigned int j = 0; j < dim; j++) {
-    for(uint64_t i = 0; i < N; i++) {
-      final_set(counter) = spacefillr::sobol_owen_single(i, j, scramble);
-      counter = counter + 1;
-    }
-  }
+NumericMatrix rcpp_generate_sobol_owen_set(uint64_t  N, unsigned int dim, unsigned int scramble,
+                                           unsigned int threads) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, dim);
+  spacefillr::generate_sobol_owen_set(N, dim, scramble, final_set.begin(), threads);
   return(final_set);
 }
 
 // [[Rcpp::export]]
 double rcpp_generate_sobol_owen_single(uint64_t  i, unsigned int dim, unsigned int scramble) {
-  return(spacefillr::sobol_owen_single(i, dim, scramble));
+  return(spacefillr::sobol_owen_single_f64(i, dim, scramble));
 }
 
 
 // [[Rcpp::export]]
-List rcpp_generate_halton_faure_set(uint64_t  N, unsigned int dim) {
-  List final_set(N*dim);
+NumericMatrix rcpp_generate_halton_faure_set(uint64_t  N, unsigned int dim, unsigned int threads) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, dim);
+  if(dim > spacefillr::Halton_sampler::get_num_dimensions()) {
+    spacefillr::halton_engine engine(dim);
+    engine.init_faure();
+    spacefillr::generate_halton_set(engine, N, dim, final_set.begin(), threads);
+    return(final_set);
+  }
   spacefillr::Halton_sampler hs;
   hs.init_faure();
-  int counter = 0;
-  for(unsigned int j = 0; j < dim; j++) {
-    for(uint64_t i = 0; i < N; i++) {
-      final_set(counter) = hs.sample(j,i);
-      counter = counter + 1;
-    }
-  }
+  spacefillr::generate_halton_set(hs, N, dim, final_set.begin(), threads);
   return(final_set);
 }
 
 
 
 // [[Rcpp::export]]
-List rcpp_generate_halton_random_set(uint64_t  N, unsigned int dim, unsigned int seed) {
-  List final_set(N*dim);
+NumericMatrix rcpp_generate_halton_random_set(uint64_t  N, unsigned int dim, unsigned int seed,
+                                              unsigned int threads) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, dim);
   random_gen rng(seed);
+  if(dim > spacefillr::Halton_sampler::get_num_dimensions()) {
+    spacefillr::halton_engine engine(dim);
+    engine.init_random(rng.rng);
+    spacefillr::generate_halton_set(engine, N, dim, final_set.begin(), threads);
+    return(final_set);
+  }
   spacefillr::Halton_sampler hs;
   hs.init_random(rng.rng);
-  int counter = 0;
-  for(unsigned int j = 0; j < dim; j++) {
-    for(uint64_t i = 0; i < N; i++) {
-      final_set(counter) = hs.sample(j,i);
-      counter = counter + 1;
-    }
-  }
+  spacefillr::generate_halton_set(hs, N, dim, final_set.begin(), threads);
   return(final_set);
 }
 
 
 // [[Rcpp::export]]
 double rcpp_generate_halton_faure_single(uint64_t  i, unsigned int dim) {
-  spacefillr::Halton_sampler hs;
-  hs.init_faure();
-  return(hs.sample(i,dim));
+  return(spacefillr::generate_halton_faure_single(i, dim));
 }
 
 
 
 // [[Rcpp::export]]
 double rcpp_generate_halton_random_single(uint64_t  i, unsigned int dim, unsigned int seed) {
-  random_gen rng(seed);
-  spacefillr::Halton_sampler hs;
-  hs.init_random(rng.rng);
-  return(hs.sample(i,dim));
+  return(spacefillr::generate_halton_random_single(i, dim, seed));
+}
+
+typedef std::shared_ptr<const spacefillr::Halton_sampler> halton_sampler_handle;
+
+// [[Rcpp::export]]
+SEXP rcpp_create_halton_sampler(bool faure, unsigned int seed) {
+  XPtr<halton_sampler_handle> sampler(new halton_sampler_handle(
+    faure ? spacefillr::Halton_sampler_registry::faure() :
+            spacefillr::Halton_sampler_registry::random(seed)), true);
+  return(sampler);
+}
+
+// [[Rcpp::export]]
+double rcpp_generate_halton_sampler_single(SEXP sampler, uint64_t  i, unsigned int dim) {
+  XPtr<halton_sampler_handle> hs(sampler);
+  return((*hs)->sample_f64(dim, i));
 }
 
 //PJ + PMJ
 
 // [[Rcpp::export]]
-List rcpp_generate_pj_set(uint64_t  N, int seed) {
-  List final_set(N*2);
+NumericMatrix rcpp_generate_pj_set(uint64_t  N, int seed) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, 2);
   random_gen rng(seed);
   std::unique_ptr<pmj::Point[]> points = pmj::GetProgJitteredSamples(N, rng);
-  int counter = 0;
   for(uint64_t i = 0; i < N; i++) {
-    final_set(counter) = points[i].x;
-    final_set(counter+1) = points[i].y;
-    counter += 2;
+    final_set(i, 0) = points[i].x;
+    final_set(i, 1) = points[i].y;
   }
   return(final_set);
 }
 
 // [[Rcpp::export]]
-List rcpp_generate_pmj_set(uint64_t  N, int seed) {
-  List final_set(N*2);
+NumericMatrix rcpp_generate_pmj_set(uint64_t  N, int seed) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, 2);
   random_gen rng(seed);
   std::unique_ptr<pmj::Point[]> points = pmj::GetProgMultiJitteredSamples(N, rng);
-  int counter = 0;
-  for(uint64_t i = 0; i < N; i++) {
-    final_set(counter) = points[i].x;
-    final_set(counter+1) = points[i].y;
-    counter += 2;
-  }
+  pmj::SplitPoints(points.get(), N, &final_set(0, 0), &final_set(0, 1));
   return(final_set);
 }
 
 
 // [[Rcpp::export]]
-List rcpp_generate_pmjbn_set(uint64_t  N, int seed) {
-  List final_set(N*2);
+NumericMatrix rcpp_generate_pmjbn_set(uint64_t  N, int seed, unsigned int threads,
+                                      int candidates, bool adaptive) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, 2);
   random_gen rng(seed);
-  std::unique_ptr<pmj::Point[]> points = pmj::GetProgMultiJitteredSamplesWithBlueNoise(N, rng);
-  int counter = 0;
-  for(uint64_t i = 0; i < N; i++) {
-    final_set(counter) = points[i].x;
-    final_set(counter+1) = points[i].y;
-    counter += 2;
-  }
+  std::unique_ptr<pmj::Point[]> points =
+    pmj::GetProgMultiJitteredSamplesWithBlueNoise(N, rng, threads, candidates, adaptive);
+  pmj::SplitPoints(points.get(), N, &final_set(0, 0), &final_set(0, 1));
   return(final_set);
 }
 
 // [[Rcpp::export]]
-List rcpp_generate_pmj02_set(uint64_t  N, int seed) {
-  List final_set(N*2);
+NumericMatrix rcpp_generate_pmj02_set(uint64_t  N, int seed) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, 2);
   random_gen rng(seed);
   std::unique_ptr<pmj::Point[]> points = pmj::GetPMJ02Samples(N, rng);
-  int counter = 0;
-  for(uint64_t i = 0; i < N; i++) {
-    final_set(counter) = points[i].x;
-    final_set(counter+1) = points[i].y;
-    counter += 2;
-  }
+  pmj::SplitPoints(points.get(), N, &final_set(0, 0), &final_set(0, 1));
   return(final_set);
 }
 
 // [[Rcpp::export]]
-List rcpp_generate_pmj02bn_set(uint64_t  N, int seed) {
-  List final_set(N*2);
+NumericMatrix rcpp_generate_pmj02bn_set(uint64_t  N, int seed, unsigned int threads,
+                                        int candidates, bool adaptive) {
+  check_set_rows(N);
+  NumericMatrix final_set((int)N, 2);
   random_gen rng(seed);
-  std::unique_ptr<pmj::Point[]> points = pmj::GetPMJ02SamplesWithBlueNoise(N, rng);
-  int counter = 0;
-  for(uint64_t i = 0; i < N; i++) {
-    final_set(counter) = points[i].x;
-    final_set(counter+1) = points[i].y;
-    counter += 2;
-  }
+  std::unique_ptr<pmj::Point[]> points =
+    pmj::GetPMJ02SamplesWithBlueNoise(N, rng, threads, candidates, adaptive);
+  pmj::SplitPoints(points.get(), N, &final_set(0, 0), &final_set(0, 1));
   return(final_set);
 }
+
+// [[Rcpp::export]]
+double rcpp_calculate_min_distance(NumericMatrix points) {
+  const int n = points.nrow();
+  std::vector<pmj::Point> pts(n);
+  for(int i = 0; i < n; i++) {
+    pts[i].x = points(i, 0);
+    pts[i].y = points(i, 1);
+  }
+  return(pmj::GetMinimumDistance(pts.data(), n));
+}
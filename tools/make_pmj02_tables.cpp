@@ -0,0 +1,67 @@
+// Generates a file of precomputed PMJ02 or PMJ02-BN tables for
+// `spacefillr::pmj02_table_file` (see inst/include/pmj02_tables.h for the
+// format). It only uses the headers in inst/include, so it builds without R.
+// From the package root:
+//
+//   g++ -std=c++17 -O2 -pthread -Iinst/include tools/make_pmj02_tables.cpp -o make_pmj02_tables
+//   ./make_pmj02_tables OUT_FILE [--tables N] [--samples N] [--seed S]
+//                       [--candidates C] [--threads T]
+//
+// Defaults: 64 tables of 4096 samples, seed 0, plain PMJ02 (--candidates 1).
+// Use e.g. --candidates 10 for PMJ02-BN.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include "pmj02_tables.h"
+
+int main(int argc, char** argv) {
+  std::string out_file;
+  uint32_t num_tables = 64;
+  uint32_t num_samples = 4096;
+  uint32_t seed = 0;
+  uint32_t num_candidates = 1;
+  unsigned int threads = 1;
+  for(int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if(arg == "--tables" && i + 1 < argc) {
+      num_tables = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+    } else if(arg == "--samples" && i + 1 < argc) {
+      num_samples = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+    } else if(arg == "--seed" && i + 1 < argc) {
+      seed = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+    } else if(arg == "--candidates" && i + 1 < argc) {
+      num_candidates = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+    } else if(arg == "--threads" && i + 1 < argc) {
+      threads = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+    } else if(out_file.empty() && arg.compare(0, 2, "--") != 0) {
+      out_file = arg;
+    } else {
+      out_file.clear();
+      break;
+    }
+  }
+  if(out_file.empty()) {
+    std::fprintf(stderr, "usage: %s OUT_FILE [--tables N] [--samples N] [--seed S] "
+                 "[--candidates C] [--threads T]\n", argv[0]);
+    return(1);
+  }
+
+  try {
+    const auto start = std::chrono::steady_clock::now();
+    spacefillr::write_pmj02_table_file(out_file, num_tables, num_samples, seed,
+                                       num_candidates, threads);
+    const double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+    spacefillr::pmj02_table_file check(out_file);
+    std::fprintf(stderr, "wrote %u tables of %u samples to %s in %.2f s\n",
+                 check.num_tables(), check.num_samples(), out_file.c_str(), seconds);
+  } catch(const std::exception& e) {
+    std::fprintf(stderr, "error: %s\n", e.what());
+    return(1);
+  }
+  return(0);
+}